@@ -36,6 +36,7 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "Cell.hpp"
 
 #include "ApoptoticCellProperty.hpp"
+#include "CellBasedEventHandler.hpp"
 #include "CellAncestor.hpp"
 #include "CellId.hpp"
 #include "CellLabel.hpp"
@@ -140,6 +141,36 @@ Cell::~Cell()
     delete mpSrnModel;
 }
 
+FreeListAllocator& Cell::rGetAllocator()
+{
+    // Deliberately never destroyed, so that objects freed during static destruction are handled safely
+    static FreeListAllocator* p_allocator = new FreeListAllocator(sizeof(Cell));
+    return *p_allocator;
+}
+
+void* Cell::operator new(std::size_t size)
+{
+    FreeListAllocator& r_allocator = rGetAllocator();
+    if (r_allocator.CanRecycle(size))
+    {
+        CellBasedEventHandler::IncrementCounter(CellBasedEventHandler::RECYCLED_ALLOCATIONS);
+    }
+    else
+    {
+        CellBasedEventHandler::IncrementCounter(CellBasedEventHandler::HEAP_ALLOCATIONS);
+    }
+    return r_allocator.Allocate(size);
+}
+
+void Cell::operator delete(void* pMemory, std::size_t size)
+{
+    if (pMemory != nullptr)
+    {
+        CellBasedEventHandler::IncrementCounter(CellBasedEventHandler::DEALLOCATIONS);
+    }
+    rGetAllocator().Deallocate(pMemory, size);
+}
+
 void Cell::SetCellProliferativeType(boost::shared_ptr<AbstractCellProperty> pProliferativeType)
 {
     if (!pProliferativeType->IsSubType<AbstractCellProliferativeType>())
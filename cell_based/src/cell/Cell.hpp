@@ -36,6 +36,7 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #ifndef CELL_HPP_
 #define CELL_HPP_
 
+#include <cstddef>
 #include <boost/utility.hpp>
 #include <boost/shared_ptr.hpp>
 #include <boost/enable_shared_from_this.hpp>
@@ -51,6 +52,7 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "AbstractCellCycleModel.hpp"
 #include "AbstractSrnModel.hpp"
 #include "CellPropertyCollection.hpp"
+#include "FreeListAllocator.hpp"
 
 class AbstractCellCycleModel; // Circular definition (cells need to know about cycle models and vice-versa).
 class AbstractSrnModel; // Circular definition (cells need to know about subcellular reaction network models and vice-versa).
@@ -90,6 +92,11 @@ class Cell : private boost::noncopyable, public boost::enable_shared_from_this<C
 {
 private:
 
+    /**
+     * @return the allocator used to recycle the memory of Cell objects.
+     */
+    static FreeListAllocator& rGetAllocator();
+
     /** Caches the result of ReadyToDivide() so Divide() can look at it. */
     bool mCanDivide;
 
@@ -173,6 +180,24 @@ public:
      */
     ~Cell();
 
+    /**
+     * Class-specific allocation function. The memory of destroyed Cell objects is recycled,
+     * which avoids repeated heap allocation in populations with constant turnover.
+     * Allocations are recorded by the CellBasedEventHandler counters.
+     *
+     * @param size the number of bytes required
+     * @return a pointer to the memory
+     */
+    static void* operator new(std::size_t size);
+
+    /**
+     * Class-specific deallocation function, which keeps the memory for reuse.
+     *
+     * @param pMemory the memory to free
+     * @param size the number of bytes that were requested when the memory was allocated
+     */
+    static void operator delete(void* pMemory, std::size_t size);
+
     /**
      * @return the cell's proliferative type.
      */
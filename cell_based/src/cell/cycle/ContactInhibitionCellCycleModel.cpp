@@ -77,7 +77,8 @@ void ContactInhibitionCellCycleModel::UpdateCellCyclePhase()
     }
 
     // Get cell volume
-    double cell_volume = mpCell->GetCellData()->GetItem("volume");
+    static const unsigned volume_index = CellData::GetItemIndex("volume");
+    double cell_volume = mpCell->GetCellData()->GetItem(volume_index);
 
     // Removes the cell label
     mpCell->RemoveCellProperty<CellLabel>();
@@ -67,7 +67,8 @@ void SimpleOxygenBasedCellCycleModel::UpdateCellCyclePhase()
         UpdateHypoxicDuration();
 
         // Get cell's oxygen concentration
-        double oxygen_concentration = mpCell->GetCellData()->GetItem("oxygen");
+        static const unsigned oxygen_index = CellData::GetItemIndex("oxygen");
+        double oxygen_concentration = mpCell->GetCellData()->GetItem(oxygen_index);
 
         AbstractSimplePhaseBasedCellCycleModel::UpdateCellCyclePhase();
 
@@ -119,7 +120,8 @@ void SimpleOxygenBasedCellCycleModel::UpdateHypoxicDuration()
     assert(!mpCell->HasApoptosisBegun());
 
     // Get cell's oxygen concentration
-    double oxygen_concentration = mpCell->GetCellData()->GetItem("oxygen");
+    static const unsigned oxygen_index = CellData::GetItemIndex("oxygen");
+    double oxygen_concentration = mpCell->GetCellData()->GetItem(oxygen_index);
 
     if (oxygen_concentration < mHypoxicConcentration)
     {
@@ -35,45 +35,150 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "CellData.hpp"
 
+#include <algorithm>
+
+#include "CellBasedEventHandler.hpp"
+
+CellData::CellData()
+    : AbstractCellProperty(),
+      mNumItems(0)
+{
+}
+
 CellData::~CellData()
 {
 }
 
+FreeListAllocator& CellData::rGetAllocator()
+{
+    // Deliberately never destroyed, so that objects freed during static destruction are handled safely
+    static FreeListAllocator* p_allocator = new FreeListAllocator(sizeof(CellData));
+    return *p_allocator;
+}
+
+void* CellData::operator new(std::size_t size)
+{
+    FreeListAllocator& r_allocator = rGetAllocator();
+    if (r_allocator.CanRecycle(size))
+    {
+        CellBasedEventHandler::IncrementCounter(CellBasedEventHandler::RECYCLED_ALLOCATIONS);
+    }
+    else
+    {
+        CellBasedEventHandler::IncrementCounter(CellBasedEventHandler::HEAP_ALLOCATIONS);
+    }
+    return r_allocator.Allocate(size);
+}
+
+void CellData::operator delete(void* pMemory, std::size_t size)
+{
+    if (pMemory != nullptr)
+    {
+        CellBasedEventHandler::IncrementCounter(CellBasedEventHandler::DEALLOCATIONS);
+    }
+    rGetAllocator().Deallocate(pMemory, size);
+}
+
+std::map<std::string, unsigned>& CellData::rGetItemIndexMap()
+{
+    static std::map<std::string, unsigned> item_index_map;
+    return item_index_map;
+}
+
+std::vector<std::string>& CellData::rGetItemNames()
+{
+    static std::vector<std::string> item_names;
+    return item_names;
+}
+
+unsigned CellData::GetItemIndex(const std::string& rVariableName)
+{
+    std::map<std::string, unsigned>& r_item_index_map = rGetItemIndexMap();
+    std::map<std::string, unsigned>::const_iterator it = r_item_index_map.find(rVariableName);
+    if (it != r_item_index_map.end())
+    {
+        return it->second;
+    }
+
+    unsigned new_index = rGetItemNames().size();
+    rGetItemNames().push_back(rVariableName);
+    r_item_index_map[rVariableName] = new_index;
+    return new_index;
+}
+
+const std::string& CellData::rGetItemName(unsigned index)
+{
+    assert(index < rGetItemNames().size());
+    return rGetItemNames()[index];
+}
+
+std::vector<unsigned> CellData::GetItemIndices(const std::vector<std::string>& rVariableNames)
+{
+    std::vector<unsigned> indices(rVariableNames.size());
+    for (unsigned i=0; i<rVariableNames.size(); i++)
+    {
+        indices[i] = GetItemIndex(rVariableNames[i]);
+    }
+    return indices;
+}
+
 void CellData::SetItem(const std::string& rVariableName, double data)
 {
-    mCellData[rVariableName] = data;
+    SetItem(GetItemIndex(rVariableName), data);
+}
+
+void CellData::SetItem(unsigned index, double data)
+{
+    if (index >= mValues.size())
+    {
+        mValues.resize(index + 1, 0.0);
+        mIsItemSet.resize(index + 1, false);
+    }
+    if (!mIsItemSet[index])
+    {
+        mIsItemSet[index] = true;
+        mNumItems++;
+    }
+    mValues[index] = data;
 }
 
 double CellData::GetItem(const std::string& rVariableName) const
 {
     /*
-     * Note that mCellData[rVariableName] is not const. If rVariableName is not
-     * a key, then mCellData[rVariableName] will create a new item in the map
-     * and increase the size by one.  Using a const_iterator ensures that the
-     * map remains const.
+     * Note that GetItemIndex() registers rVariableName if it has not been seen
+     * before; this is harmless, since the new index cannot have been set for this
+     * cell, so the lookup below will fail with the expected exception.
      */
-    std::map<std::string, double>::const_iterator it = mCellData.find(rVariableName);
-    if (it == mCellData.end())
+    return GetItem(GetItemIndex(rVariableName));
+}
+
+double CellData::GetItem(unsigned index) const
+{
+    if (index >= mValues.size() || !mIsItemSet[index])
     {
-        EXCEPTION("The item " << rVariableName << " is not stored");
+        EXCEPTION("The item " << rGetItemName(index) << " is not stored");
     }
-    return(it->second);
+    return mValues[index];
 }
 
 unsigned CellData::GetNumItems() const
 {
-    return mCellData.size();
+    return mNumItems;
 }
 
 std::vector<std::string> CellData::GetKeys() const
 {
     std::vector<std::string> keys;
-    for (std::map<std::string, double>::const_iterator it = mCellData.begin(); it != mCellData.end(); ++it)
+    for (unsigned index=0; index<mValues.size(); index++)
     {
-        keys.push_back(it->first);
+        if (mIsItemSet[index])
+        {
+            keys.push_back(rGetItemNames()[index]);
+        }
     }
 
-    // From STL documentation we assume that the iterator is returning sorted keys sort(keys.begin(), keys.end());
+    // Item indices are allocated in order of first use, so sort to give a predictable ordering
+    std::sort(keys.begin(), keys.end());
     return keys;
 }
 
@@ -37,6 +37,7 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #define CELLDATA_HPP_
 
 #include <boost/shared_ptr.hpp>
+#include <cstddef>
 #include <map>
 #include <string>
 #include <vector>
@@ -46,6 +47,7 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <boost/serialization/base_object.hpp>
 #include <boost/serialization/map.hpp>
 #include "Exception.hpp"
+#include "FreeListAllocator.hpp"
 
 /**
  * CellData class.
@@ -54,6 +56,12 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  * for example corresponding to the intracellular oxygen concentration. Other classes may interrogate
  * or modify the values stored in this class.
  *
+ * Item names are interned, once per simulation, into integer indices shared by all cells (see
+ * GetItemIndex()), and each cell stores its values in a flat vector indexed by these. Code that
+ * accesses the same item for many cells should look up the index once and use the index-based
+ * GetItem() and SetItem() methods, which avoid any string comparisons. The string-based methods
+ * are provided for convenience and compatibility.
+ *
  * Within the Cell constructor, an empty CellData object is created and passed to the Cell
  * (unless there is already a CellData object present in mCellPropertyCollection).
  */
@@ -62,33 +70,134 @@ class CellData : public AbstractCellProperty
 private:
 
     /**
-     * The cell data.
+     * @return the allocator used to recycle the memory of CellData objects.
+     */
+    static FreeListAllocator& rGetAllocator();
+
+    /**
+     * The cell data, indexed by item index. Only entries for which mIsItemSet is true are meaningful.
+     */
+    std::vector<double> mValues;
+
+    /**
+     * Whether each entry of mValues has been set for this cell.
+     */
+    std::vector<bool> mIsItemSet;
+
+    /**
+     * The number of items that have been set for this cell.
+     */
+    unsigned mNumItems;
+
+    /**
+     * @return the map from item names to item indices, shared by all cells.
+     */
+    static std::map<std::string, unsigned>& rGetItemIndexMap();
+
+    /**
+     * @return the item names, indexed by item index, shared by all cells.
      */
-    std::map<std::string, double> mCellData;
+    static std::vector<std::string>& rGetItemNames();
 
     /** Needed for serialization. */
     friend class boost::serialization::access;
     /**
      * Archive the member variables.
      *
+     * The data are archived as a map from item names to values, since item
+     * indices are only meaningful within a single run.
+     *
      * @param archive the archive
      * @param version the current version of this class
      */
     template<class Archive>
-    void serialize(Archive & archive, const unsigned int version)
+    void save(Archive & archive, const unsigned int version) const
     {
         archive & boost::serialization::base_object<AbstractCellProperty>(*this);
-        archive & mCellData;
+        std::map<std::string, double> cell_data;
+        for (unsigned index=0; index<mValues.size(); index++)
+        {
+            if (mIsItemSet[index])
+            {
+                cell_data[rGetItemNames()[index]] = mValues[index];
+            }
+        }
+        archive & cell_data;
     }
 
+    /**
+     * Load the member variables.
+     *
+     * @param archive the archive
+     * @param version the current version of this class
+     */
+    template<class Archive>
+    void load(Archive & archive, const unsigned int version)
+    {
+        archive & boost::serialization::base_object<AbstractCellProperty>(*this);
+        std::map<std::string, double> cell_data;
+        archive & cell_data;
+        for (std::map<std::string, double>::const_iterator it = cell_data.begin(); it != cell_data.end(); ++it)
+        {
+            SetItem(it->first, it->second);
+        }
+    }
+    BOOST_SERIALIZATION_SPLIT_MEMBER()
+
 public:
 
+    /**
+     * Default constructor.
+     */
+    CellData();
+
     /**
      * We need the empty virtual destructor in this class to ensure Boost
      * serialization works correctly with static libraries.
      */
     virtual ~CellData();
 
+    /**
+     * Class-specific allocation function. The memory of destroyed CellData objects is recycled,
+     * which avoids repeated heap allocation in populations with constant turnover.
+     * Allocations are recorded by the CellBasedEventHandler counters.
+     *
+     * @param size the number of bytes required
+     * @return a pointer to the memory
+     */
+    static void* operator new(std::size_t size);
+
+    /**
+     * Class-specific deallocation function, which keeps the memory for reuse.
+     *
+     * @param pMemory the memory to free
+     * @param size the number of bytes that were requested when the memory was allocated
+     */
+    static void operator delete(void* pMemory, std::size_t size);
+
+    /**
+     * Get the index used to store a named item, registering the name if it has
+     * not been seen before. The index is the same for all cells.
+     *
+     * @param rVariableName the name of the data item.
+     * @return the index of the item.
+     */
+    static unsigned GetItemIndex(const std::string& rVariableName);
+
+    /**
+     * @return the name of the data item with a given index.
+     *
+     * @param index the index of the data item, as returned by GetItemIndex().
+     */
+    static const std::string& rGetItemName(unsigned index);
+
+    /**
+     * @return the indices of several named data items, as returned by GetItemIndex().
+     *
+     * @param rVariableNames the names of the data items.
+     */
+    static std::vector<unsigned> GetItemIndices(const std::vector<std::string>& rVariableNames);
+
     /**
      * This assigns the cell data.
      *
@@ -97,6 +206,14 @@ public:
      */
     void SetItem(const std::string& rVariableName, double data);
 
+    /**
+     * This assigns the cell data using an index obtained from GetItemIndex().
+     *
+     * @param index the index of the data to be set.
+     * @param data the value to set it to.
+     */
+    void SetItem(unsigned index, double data);
+
     /**
      * @return data.
      *
@@ -105,6 +222,14 @@ public:
      */
     double GetItem(const std::string& rVariableName) const;
 
+    /**
+     * @return data.
+     *
+     * @param index the index of the data required, as returned by GetItemIndex().
+     * throws if the item has not been stored
+     */
+    double GetItem(unsigned index) const;
+
     /**
      * @return number of data items
      */
@@ -113,7 +238,7 @@ public:
     /**
      * @return all keys.
      *
-     * According to STL these are sorted in lexicographical/alphabetic order (so that the ordering here is predictable).
+     * These are sorted in lexicographical/alphabetic order (so that the ordering here is predictable).
      */
     std::vector<std::string> GetKeys() const;
 };
@@ -99,7 +99,8 @@ void DeltaNotchSrnModel::UpdateDeltaNotch()
     assert(mpOdeSystem != nullptr);
     assert(mpCell != nullptr);
 
-    double mean_delta = mpCell->GetCellData()->GetItem("mean delta");
+    static const unsigned mean_delta_index = CellData::GetItemIndex("mean delta");
+    double mean_delta = mpCell->GetCellData()->GetItem(mean_delta_index);
     mpOdeSystem->SetParameter("Mean Delta", mean_delta);
 }
 
@@ -126,76 +126,100 @@ void AbstractBoxDomainPdeModifier<DIM>::GenerateFeMesh(boost::shared_ptr<ChasteC
 
     // Now move the mesh to the correct location
     this->mpFeMesh->Translate(centre_of_cuboid - centre_of_coarse_mesh);
+
+    // The mesh is fixed, so set up a spatial index once to speed up locating cells in it
+    this->mpFeMesh->SetUpElementSpatialIndex();
 }
 
 template<unsigned DIM>
 void AbstractBoxDomainPdeModifier<DIM>::UpdateCellData(AbstractCellPopulation<DIM,DIM>& rCellPopulation)
 {
-    // Store the PDE solution in an accessible form
-    ReplicatableVector solution_repl(this->mSolution);
+    UpdateCellData(rCellPopulation,
+                   std::vector<Vec>(1, this->mSolution),
+                   std::vector<std::string>(1, this->mDependentVariableName));
+}
+
+template<unsigned DIM>
+void AbstractBoxDomainPdeModifier<DIM>::UpdateCellData(AbstractCellPopulation<DIM,DIM>& rCellPopulation,
+                                                       const std::vector<Vec>& rSolutions,
+                                                       const std::vector<std::string>& rVariableNames)
+{
+    assert(rSolutions.size() == rVariableNames.size());
+    const unsigned num_solutions = rSolutions.size();
+
+    // Store the PDE solutions in an accessible form
+    std::vector<ReplicatableVector> solutions_repl(num_solutions);
+    for (unsigned s=0; s<num_solutions; s++)
+    {
+        solutions_repl[s].ReplicatePetscVector(rSolutions[s]);
+    }
+
+    // Look up the cell data item indices once, rather than for every cell
+    std::vector<unsigned> solution_indices(num_solutions);
+    std::vector<c_vector<unsigned, DIM> > gradient_indices(num_solutions);
+    for (unsigned s=0; s<num_solutions; s++)
+    {
+        solution_indices[s] = CellData::GetItemIndex(rVariableNames[s]);
+        if (this->mOutputGradient)
+        {
+            gradient_indices[s] = this->GetGradientCellDataItemIndices(rVariableNames[s]);
+        }
+    }
 
     for (typename AbstractCellPopulation<DIM>::Iterator cell_iter = rCellPopulation.Begin();
          cell_iter != rCellPopulation.End();
          ++cell_iter)
     {
-        // The cells are not nodes of the mesh, so we must interpolate
-        double solution_at_cell = 0.0;
-
         // Find the element in the FE mesh that contains this cell. CellElementMap has been updated so use this.
         unsigned elem_index = mCellPdeElementMap[*cell_iter];
         Element<DIM,DIM>* p_element = this->mpFeMesh->GetElement(elem_index);
 
         const ChastePoint<DIM>& node_location = rCellPopulation.GetLocationOfCellCentre(*cell_iter);
 
+        // The cells are not nodes of the mesh, so we must interpolate
         c_vector<double,DIM+1> weights = p_element->CalculateInterpolationWeights(node_location);
 
-        for (unsigned i=0; i<DIM+1; i++)
-        {
-            double nodal_value = solution_repl[p_element->GetNodeGlobalIndex(i)];
-            solution_at_cell += nodal_value * weights(i);
-        }
-
-        cell_iter->GetCellData()->SetItem(this->mDependentVariableName, solution_at_cell);
-
+        c_matrix<double, DIM, DIM+1> grad_phi;
         if (this->mOutputGradient)
         {
-            // Now calculate the gradient of the solution and store this in CellVecData
-            c_vector<double, DIM> solution_gradient = zero_vector<double>(DIM);
-
             // Calculate the basis functions at any point (e.g. zero) in the element
             c_matrix<double, DIM, DIM> jacobian, inverse_jacobian;
             double jacobian_det;
             this->mpFeMesh->GetInverseJacobianForElement(elem_index, jacobian, jacobian_det, inverse_jacobian);
             const ChastePoint<DIM> zero_point;
-            c_matrix<double, DIM, DIM+1> grad_phi;
             LinearBasisFunction<DIM>::ComputeTransformedBasisFunctionDerivatives(zero_point, inverse_jacobian, grad_phi);
+        }
+
+        boost::shared_ptr<CellData> p_cell_data = cell_iter->GetCellData();
 
-            for (unsigned node_index=0; node_index<DIM+1; node_index++)
+        for (unsigned s=0; s<num_solutions; s++)
+        {
+            double solution_at_cell = 0.0;
+            c_vector<double, DIM> solution_gradient = zero_vector<double>(DIM);
+
+            for (unsigned i=0; i<DIM+1; i++)
             {
-                double nodal_value = solution_repl[p_element->GetNodeGlobalIndex(node_index)];
+                double nodal_value = solutions_repl[s][p_element->GetNodeGlobalIndex(i)];
+                solution_at_cell += nodal_value * weights(i);
 
-                for (unsigned j=0; j<DIM; j++)
+                if (this->mOutputGradient)
                 {
-                    solution_gradient(j) += nodal_value* grad_phi(j, node_index);
+                    for (unsigned j=0; j<DIM; j++)
+                    {
+                        solution_gradient(j) += nodal_value* grad_phi(j, i);
+                    }
                 }
             }
 
-            switch (DIM)
+            p_cell_data->SetItem(solution_indices[s], solution_at_cell);
+
+            if (this->mOutputGradient)
             {
-                case 1:
-                    cell_iter->GetCellData()->SetItem(this->mDependentVariableName+"_grad_x", solution_gradient(0));
-                    break;
-                case 2:
-                    cell_iter->GetCellData()->SetItem(this->mDependentVariableName+"_grad_x", solution_gradient(0));
-                    cell_iter->GetCellData()->SetItem(this->mDependentVariableName+"_grad_y", solution_gradient(1));
-                    break;
-                case 3:
-                    cell_iter->GetCellData()->SetItem(this->mDependentVariableName+"_grad_x", solution_gradient(0));
-                    cell_iter->GetCellData()->SetItem(this->mDependentVariableName+"_grad_y", solution_gradient(1));
-                    cell_iter->GetCellData()->SetItem(this->mDependentVariableName+"_grad_z", solution_gradient(2));
-                    break;
-                default:
-                    NEVER_REACHED;
+                // Store the gradient of the solution in CellData
+                for (unsigned j=0; j<DIM; j++)
+                {
+                    p_cell_data->SetItem(gradient_indices[s][j], solution_gradient(j));
+                }
             }
         }
     }
@@ -96,6 +96,20 @@ protected:
      */
     bool mSetBcsOnBoxBoundary;
 
+    /**
+     * Helper method to copy several PDE solutions on mpFeMesh to CellData in a single
+     * sweep over the cell population. The interpolation weights (and, if mOutputGradient
+     * is true, the basis function gradients) are computed once per cell and shared by
+     * all of the solutions.
+     *
+     * @param rCellPopulation reference to the cell population
+     * @param rSolutions the solution vectors
+     * @param rVariableNames the names of the dependent variables, in the same order as rSolutions
+     */
+    void UpdateCellData(AbstractCellPopulation<DIM,DIM>& rCellPopulation,
+                        const std::vector<Vec>& rSolutions,
+                        const std::vector<std::string>& rVariableNames);
+
 public:
 
     /**
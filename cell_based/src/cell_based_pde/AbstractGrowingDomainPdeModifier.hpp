@@ -106,6 +106,17 @@ public:
      */
     void UpdateCellData(AbstractCellPopulation<DIM,DIM>& rCellPopulation);
 
+    /**
+     * Helper method to copy the values of the dependent variable stored in CellData to a
+     * vector indexed by the nodes of mpFeMesh. Since daughter cells inherit the CellData
+     * of their parent, this gives a natural interpolation of the solution on the previous
+     * time step onto the current finite element mesh.
+     *
+     * @param rCellPopulation reference to the cell population
+     * @param solution the vector to fill, which must have one entry for each node of mpFeMesh
+     */
+    void CopyCellDataToSolutionVector(AbstractCellPopulation<DIM,DIM>& rCellPopulation, Vec solution);
+
 
     /**
      * Overridden OutputSimulationModifierParameters() method.
@@ -222,6 +222,25 @@ void AbstractPdeModifier<DIM>::UpdateAtEndOfSolve(AbstractCellPopulation<DIM,DIM
     }
 }
 
+template<unsigned DIM>
+c_vector<unsigned, DIM> AbstractPdeModifier<DIM>::GetGradientCellDataItemIndices()
+{
+    return GetGradientCellDataItemIndices(mDependentVariableName);
+}
+
+template<unsigned DIM>
+c_vector<unsigned, DIM> AbstractPdeModifier<DIM>::GetGradientCellDataItemIndices(const std::string& rVariableName)
+{
+    const std::string suffixes[3] = {"_grad_x", "_grad_y", "_grad_z"};
+
+    c_vector<unsigned, DIM> gradient_indices;
+    for (unsigned j=0; j<DIM; j++)
+    {
+        gradient_indices[j] = CellData::GetItemIndex(rVariableName + suffixes[j]);
+    }
+    return gradient_indices;
+}
+
 template<unsigned DIM>
 bool AbstractPdeModifier<DIM>::GetOutputGradient()
 {
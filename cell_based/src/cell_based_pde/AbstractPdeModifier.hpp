@@ -130,6 +130,21 @@ protected:
      */
     bool mDeleteFeMesh;
 
+    /**
+     * @return the CellData item indices under which the components of the gradient of
+     * the solution are stored, i.e. those of mDependentVariableName+"_grad_x" etc.
+     * Used to avoid looking up the item names for every cell.
+     */
+    c_vector<unsigned, DIM> GetGradientCellDataItemIndices();
+
+    /**
+     * @return the CellData item indices under which the components of the gradient of
+     * the given dependent variable are stored, i.e. those of rVariableName+"_grad_x" etc.
+     *
+     * @param rVariableName the name of the dependent variable
+     */
+    c_vector<unsigned, DIM> GetGradientCellDataItemIndices(const std::string& rVariableName);
+
 public:
 
     /**
@@ -34,7 +34,10 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 */
 
 #include "EllipticBoxDomainPdeModifier.hpp"
+#include <algorithm>
+#include <cfloat>
 #include "SimpleLinearEllipticSolver.hpp"
+#include "AveragedSourceEllipticPde.hpp"
 
 template<unsigned DIM>
 EllipticBoxDomainPdeModifier<DIM>::EllipticBoxDomainPdeModifier(boost::shared_ptr<AbstractLinearPde<DIM,DIM> > pPde,
@@ -48,42 +51,166 @@ EllipticBoxDomainPdeModifier<DIM>::EllipticBoxDomainPdeModifier(boost::shared_pt
                                          isNeumannBoundaryCondition,
                                         pMeshCuboid,
                                         stepSize,
-                                        solution)
+                                        solution),
+      mTimeStepsPerSolve(1),
+      mSourceTermChangeTolerance(DBL_MAX)
 {
 }
 
 template<unsigned DIM>
 EllipticBoxDomainPdeModifier<DIM>::~EllipticBoxDomainPdeModifier()
 {
+    for (unsigned i=0; i<mAdditionalSolutions.size(); i++)
+    {
+        if (mAdditionalSolutions[i])
+        {
+            PetscTools::Destroy(mAdditionalSolutions[i]);
+        }
+    }
 }
 
 template<unsigned DIM>
 void EllipticBoxDomainPdeModifier<DIM>::UpdateAtEndOfTimeStep(AbstractCellPopulation<DIM,DIM>& rCellPopulation)
+{
+    bool solve_pdes = (this->mSolution == nullptr) || (SimulationTime::Instance()->GetTimeStepsElapsed()%mTimeStepsPerSolve == 0);
+    for (unsigned i=0; i<mAdditionalSolutions.size(); i++)
+    {
+        solve_pdes = solve_pdes || (mAdditionalSolutions[i] == nullptr);
+    }
+
+    if (solve_pdes)
+    {
+        SolvePdes(rCellPopulation);
+    }
+    else
+    {
+        // Between solves, just interpolate the most recent solutions to the current cell locations...
+        this->UpdateCellPdeElementMap(rCellPopulation);
+
+        // ...unless the source terms have changed too much since the most recent solve
+        if (HaveSourceTermsChanged(rCellPopulation))
+        {
+            SolvePdes(rCellPopulation);
+        }
+    }
+
+    std::vector<Vec> solutions;
+    std::vector<std::string> variable_names;
+    solutions.push_back(this->mSolution);
+    variable_names.push_back(this->mDependentVariableName);
+    for (unsigned i=0; i<mAdditionalSolutions.size(); i++)
+    {
+        solutions.push_back(mAdditionalSolutions[i]);
+        variable_names.push_back(mAdditionalDependentVariableNames[i]);
+    }
+
+    // Write all of the solutions to CellData in a single sweep over the cell population
+    this->UpdateCellData(rCellPopulation, solutions, variable_names);
+}
+
+template<unsigned DIM>
+void EllipticBoxDomainPdeModifier<DIM>::SolvePdes(AbstractCellPopulation<DIM,DIM>& rCellPopulation)
 {
     // Set up boundary conditions
     std::shared_ptr<BoundaryConditionsContainer<DIM,DIM,1> > p_bcc = ConstructBoundaryConditionsContainer(rCellPopulation);
+    std::vector<std::shared_ptr<BoundaryConditionsContainer<DIM,DIM,1> > > additional_bccs;
+    for (unsigned i=0; i<mAdditionalPdes.size(); i++)
+    {
+        additional_bccs.push_back(ConstructBoundaryConditionsContainer(rCellPopulation, mAdditionalBoundaryConditions[i].get()));
+    }
 
+    // The cell to element map is shared by all species, so only needs updating once
     this->UpdateCellPdeElementMap(rCellPopulation);
 
     // When using a PDE mesh which doesn't coincide with the cells, we must set up the source terms before solving the PDE.
     // Pass in already updated CellPdeElementMap to speed up finding cells.
     this->SetUpSourceTermsForAveragedSourcePde(this->mpFeMesh, &this->mCellPdeElementMap);
 
+    // Record the cells in each element if we need to detect changes in the source terms before the next solve
+    if (mSourceTermChangeTolerance < DBL_MAX)
+    {
+        CountCellsInElements(rCellPopulation, mElementCellCountsAtLastSolve);
+    }
+
     // Use SimpleLinearEllipticSolver as Averaged Source PDE
     ///\todo allow other PDE classes to be used with this modifier
     SimpleLinearEllipticSolver<DIM,DIM> solver(this->mpFeMesh,
                                                boost::static_pointer_cast<AbstractLinearEllipticPde<DIM,DIM> >(this->GetPde()).get(),
                                                p_bcc.get());
 
-    ///\todo Use solution at previous time step as an initial guess for Solve()
+    // The mesh is fixed, so the solution at the previous time step (if any) is a good initial guess
     Vec old_solution_copy = this->mSolution;
-    this->mSolution = solver.Solve();
     if (old_solution_copy != nullptr)
     {
+        // The initial guess is copied by Solve(), so we must still destroy the old solution here
+        this->mSolution = solver.Solve(old_solution_copy);
         PetscTools::Destroy(old_solution_copy);
     }
+    else
+    {
+        this->mSolution = solver.Solve();
+    }
+
+    // Solve the PDE for each additional species in turn on the same mesh
+    for (unsigned i=0; i<mAdditionalPdes.size(); i++)
+    {
+        boost::shared_ptr<AveragedSourceEllipticPde<DIM> > p_averaged_pde =
+            boost::dynamic_pointer_cast<AveragedSourceEllipticPde<DIM> >(mAdditionalPdes[i]);
+        if (p_averaged_pde)
+        {
+            p_averaged_pde->SetupSourceTerms(*(this->mpFeMesh), &this->mCellPdeElementMap);
+        }
+
+        SimpleLinearEllipticSolver<DIM,DIM> additional_solver(this->mpFeMesh,
+                                                              mAdditionalPdes[i].get(),
+                                                              additional_bccs[i].get());
+
+        Vec old_additional_solution = mAdditionalSolutions[i];
+        if (old_additional_solution != nullptr)
+        {
+            mAdditionalSolutions[i] = additional_solver.Solve(old_additional_solution);
+            PetscTools::Destroy(old_additional_solution);
+        }
+        else
+        {
+            mAdditionalSolutions[i] = additional_solver.Solve();
+        }
+    }
+}
+
+template<unsigned DIM>
+void EllipticBoxDomainPdeModifier<DIM>::CountCellsInElements(AbstractCellPopulation<DIM,DIM>& rCellPopulation, std::vector<unsigned>& rCounts)
+{
+    rCounts.assign(this->mpFeMesh->GetNumElements(), 0);
+    for (typename AbstractCellPopulation<DIM>::Iterator cell_iter = rCellPopulation.Begin();
+         cell_iter != rCellPopulation.End();
+         ++cell_iter)
+    {
+        rCounts[this->mCellPdeElementMap[*cell_iter]]++;
+    }
+}
+
+template<unsigned DIM>
+bool EllipticBoxDomainPdeModifier<DIM>::HaveSourceTermsChanged(AbstractCellPopulation<DIM,DIM>& rCellPopulation)
+{
+    if (mSourceTermChangeTolerance == DBL_MAX || mElementCellCountsAtLastSolve.empty())
+    {
+        return false;
+    }
 
-    this->UpdateCellData(rCellPopulation);
+    std::vector<unsigned> counts;
+    CountCellsInElements(rCellPopulation, counts);
+
+    unsigned num_cells_at_last_solve = 0;
+    unsigned change = 0;
+    for (unsigned elem_index=0; elem_index<counts.size(); elem_index++)
+    {
+        unsigned previous_count = mElementCellCountsAtLastSolve[elem_index];
+        num_cells_at_last_solve += previous_count;
+        change += (counts[elem_index] > previous_count) ? (counts[elem_index] - previous_count) : (previous_count - counts[elem_index]);
+    }
+
+    return ((double)change > mSourceTermChangeTolerance*std::max(num_cells_at_last_solve, 1u));
 }
 
 template<unsigned DIM>
@@ -98,6 +225,13 @@ void EllipticBoxDomainPdeModifier<DIM>::SetupSolve(AbstractCellPopulation<DIM,DI
 
 template<unsigned DIM>
 std::shared_ptr<BoundaryConditionsContainer<DIM,DIM,1> > EllipticBoxDomainPdeModifier<DIM>::ConstructBoundaryConditionsContainer(AbstractCellPopulation<DIM,DIM>& rCellPopulation)
+{
+    return ConstructBoundaryConditionsContainer(rCellPopulation, this->mpBoundaryCondition.get());
+}
+
+template<unsigned DIM>
+std::shared_ptr<BoundaryConditionsContainer<DIM,DIM,1> > EllipticBoxDomainPdeModifier<DIM>::ConstructBoundaryConditionsContainer(AbstractCellPopulation<DIM,DIM>& rCellPopulation,
+                                                                                                                                 AbstractBoundaryCondition<DIM>* pBoundaryCondition)
 {
     std::shared_ptr<BoundaryConditionsContainer<DIM,DIM,1> > p_bcc(new BoundaryConditionsContainer<DIM,DIM,1>(false));
 
@@ -136,7 +270,7 @@ std::shared_ptr<BoundaryConditionsContainer<DIM,DIM,1> > EllipticBoxDomainPdeMod
              iter != coarse_mesh_boundary_node_indices.end();
              ++iter)
         {
-            p_bcc->AddDirichletBoundaryCondition(this->mpFeMesh->GetNode(*iter), this->mpBoundaryCondition.get(), 0, false);
+            p_bcc->AddDirichletBoundaryCondition(this->mpFeMesh->GetNode(*iter), pBoundaryCondition, 0, false);
         }
     }
     else // Apply BC at boundary nodes of box domain FE mesh
@@ -145,17 +279,89 @@ std::shared_ptr<BoundaryConditionsContainer<DIM,DIM,1> > EllipticBoxDomainPdeMod
              node_iter != this->mpFeMesh->GetBoundaryNodeIteratorEnd();
              ++node_iter)
         {
-            p_bcc->AddDirichletBoundaryCondition(*node_iter, this->mpBoundaryCondition.get());
+            p_bcc->AddDirichletBoundaryCondition(*node_iter, pBoundaryCondition);
         }
     }
 
     return p_bcc;
 }
 
+template<unsigned DIM>
+void EllipticBoxDomainPdeModifier<DIM>::SetTimeStepsPerSolve(unsigned timeStepsPerSolve)
+{
+    if (timeStepsPerSolve == 0)
+    {
+        EXCEPTION("The number of time steps per solve must be positive.");
+    }
+    mTimeStepsPerSolve = timeStepsPerSolve;
+}
+
+template<unsigned DIM>
+unsigned EllipticBoxDomainPdeModifier<DIM>::GetTimeStepsPerSolve() const
+{
+    return mTimeStepsPerSolve;
+}
+
+template<unsigned DIM>
+void EllipticBoxDomainPdeModifier<DIM>::SetSourceTermChangeTolerance(double sourceTermChangeTolerance)
+{
+    if (sourceTermChangeTolerance < 0.0)
+    {
+        EXCEPTION("The source term change tolerance must be non-negative.");
+    }
+    mSourceTermChangeTolerance = sourceTermChangeTolerance;
+}
+
+template<unsigned DIM>
+double EllipticBoxDomainPdeModifier<DIM>::GetSourceTermChangeTolerance() const
+{
+    return mSourceTermChangeTolerance;
+}
+
+template<unsigned DIM>
+void EllipticBoxDomainPdeModifier<DIM>::AddPde(boost::shared_ptr<AbstractLinearEllipticPde<DIM,DIM> > pPde,
+                                               boost::shared_ptr<AbstractBoundaryCondition<DIM> > pBoundaryCondition,
+                                               const std::string& rVariableName)
+{
+    if (rVariableName == this->mDependentVariableName)
+    {
+        EXCEPTION("The dependent variable name " << rVariableName << " is already in use.");
+    }
+    for (unsigned i=0; i<mAdditionalDependentVariableNames.size(); i++)
+    {
+        if (rVariableName == mAdditionalDependentVariableNames[i])
+        {
+            EXCEPTION("The dependent variable name " << rVariableName << " is already in use.");
+        }
+    }
+
+    mAdditionalPdes.push_back(pPde);
+    mAdditionalBoundaryConditions.push_back(pBoundaryCondition);
+    mAdditionalDependentVariableNames.push_back(rVariableName);
+    mAdditionalSolutions.push_back(nullptr);
+}
+
+template<unsigned DIM>
+unsigned EllipticBoxDomainPdeModifier<DIM>::GetNumAdditionalPdes() const
+{
+    return mAdditionalPdes.size();
+}
+
+template<unsigned DIM>
+Vec EllipticBoxDomainPdeModifier<DIM>::GetAdditionalSolution(unsigned index)
+{
+    assert(index < mAdditionalSolutions.size());
+    return mAdditionalSolutions[index];
+}
+
 template<unsigned DIM>
 void EllipticBoxDomainPdeModifier<DIM>::OutputSimulationModifierParameters(out_stream& rParamsFile)
 {
-    // No parameters to output, so just call method on direct parent class
+    *rParamsFile << "\t\t\t<TimeStepsPerSolve>" << mTimeStepsPerSolve << "</TimeStepsPerSolve>\n";
+    *rParamsFile << "\t\t\t<SourceTermChangeTolerance>" << mSourceTermChangeTolerance << "</SourceTermChangeTolerance>\n";
+    *rParamsFile << "\t\t\t<NumAdditionalPdes>" << mAdditionalPdes.size() << "</NumAdditionalPdes>\n";
+
+    // Call method on direct parent class
     AbstractBoxDomainPdeModifier<DIM>::OutputSimulationModifierParameters(rParamsFile);
 }
 
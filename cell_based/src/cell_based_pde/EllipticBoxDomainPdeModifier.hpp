@@ -37,9 +37,12 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #define ELLIPTICBOXDOMAINPDEMODIFIER_HPP_
 
 #include "ChasteSerialization.hpp"
+#include "ChasteSerializationVersion.hpp"
 #include <boost/serialization/base_object.hpp>
+#include <boost/serialization/vector.hpp>
 
 #include "AbstractBoxDomainPdeModifier.hpp"
+#include "AbstractLinearEllipticPde.hpp"
 #include "BoundaryConditionsContainer.hpp"
 #include "PetscTools.hpp"
 #include "FileFinder.hpp"
@@ -69,6 +72,77 @@ class EllipticBoxDomainPdeModifier : public AbstractBoxDomainPdeModifier<DIM>
 
 private:
 
+    /**
+     * The number of time steps between solves of the PDE. On intermediate time steps the
+     * solution from the most recent solve is interpolated to the current cell locations.
+     * Defaults to 1, i.e. the PDE is solved on every time step.
+     */
+    unsigned mTimeStepsPerSolve;
+
+    /**
+     * The relative change in the number of cells in each element of the FE mesh, since the
+     * most recent solve, above which the PDE is solved before the next scheduled solve. The
+     * change is the sum over elements of the absolute change in the number of cells, divided
+     * by the number of cells at the most recent solve. It is driven by births, deaths and cells
+     * moving between elements, which is how the source terms of averaged source PDEs change.
+     * Defaults to DBL_MAX, i.e. the PDE is solved only every mTimeStepsPerSolve time steps.
+     */
+    double mSourceTermChangeTolerance;
+
+    /**
+     * The number of cells in each element of the FE mesh at the most recent solve. Only
+     * recorded if mSourceTermChangeTolerance has been set. Not archived, so no early solve
+     * takes place before the first solve after loading.
+     */
+    std::vector<unsigned> mElementCellCountsAtLastSolve;
+
+    /**
+     * Linear elliptic PDEs for any additional species, solved on the same FE mesh as mpPde.
+     * These share mpFeMesh, mCellPdeElementMap and the sweep over the cell population that
+     * updates CellData.
+     */
+    std::vector<boost::shared_ptr<AbstractLinearEllipticPde<DIM,DIM> > > mAdditionalPdes;
+
+    /** The (Dirichlet) boundary condition for each of mAdditionalPdes. */
+    std::vector<boost::shared_ptr<AbstractBoundaryCondition<DIM> > > mAdditionalBoundaryConditions;
+
+    /** The name of the dependent variable of each of mAdditionalPdes. */
+    std::vector<std::string> mAdditionalDependentVariableNames;
+
+    /**
+     * The solution of each of mAdditionalPdes at the current time step. These are not
+     * archived, so are recomputed on the first time step after loading.
+     */
+    std::vector<Vec> mAdditionalSolutions;
+
+    /**
+     * Helper method to solve the PDE for every species on the current time step,
+     * using the solutions at the previous solve (if any) as initial guesses.
+     * Also updates mCellPdeElementMap, once the boundary conditions have been set up.
+     *
+     * @param rCellPopulation reference to the cell population
+     */
+    void SolvePdes(AbstractCellPopulation<DIM,DIM>& rCellPopulation);
+
+    /**
+     * Helper method to count the cells in each element of the FE mesh, using mCellPdeElementMap.
+     *
+     * @param rCellPopulation reference to the cell population
+     * @param rCounts filled with the number of cells in each element
+     */
+    void CountCellsInElements(AbstractCellPopulation<DIM,DIM>& rCellPopulation, std::vector<unsigned>& rCounts);
+
+    /**
+     * Helper method to decide whether the source terms have changed enough since the most
+     * recent solve for the PDE to be solved before the next scheduled solve.
+     * Must be called after mCellPdeElementMap has been updated.
+     *
+     * @param rCellPopulation reference to the cell population
+     *
+     * @return whether the relative change exceeds mSourceTermChangeTolerance
+     */
+    bool HaveSourceTermsChanged(AbstractCellPopulation<DIM,DIM>& rCellPopulation);
+
     /** Needed for serialization. */
     friend class boost::serialization::access;
     /**
@@ -82,6 +156,21 @@ private:
     void serialize(Archive & archive, const unsigned int version)
     {
         archive & boost::serialization::base_object<AbstractBoxDomainPdeModifier<DIM> >(*this);
+        if (version > 0)
+        {
+            archive & mTimeStepsPerSolve;
+        }
+        if (version > 1)
+        {
+            archive & mAdditionalPdes;
+            archive & mAdditionalBoundaryConditions;
+            archive & mAdditionalDependentVariableNames;
+            mAdditionalSolutions.resize(mAdditionalPdes.size(), nullptr);
+        }
+        if (version > 2)
+        {
+            archive & mSourceTermChangeTolerance;
+        }
     }
 
 public:
@@ -137,6 +226,69 @@ public:
      */
     virtual std::shared_ptr<BoundaryConditionsContainer<DIM,DIM,1> > ConstructBoundaryConditionsContainer(AbstractCellPopulation<DIM,DIM>& rCellPopulation);
 
+    /**
+     * Helper method to construct the boundary conditions container for the PDE
+     * with the given boundary condition.
+     *
+     * @param rCellPopulation reference to the cell population
+     * @param pBoundaryCondition the (Dirichlet) boundary condition to impose
+     *
+     * @return the full boundary conditions container
+     */
+    std::shared_ptr<BoundaryConditionsContainer<DIM,DIM,1> > ConstructBoundaryConditionsContainer(AbstractCellPopulation<DIM,DIM>& rCellPopulation,
+                                                                                                  AbstractBoundaryCondition<DIM>* pBoundaryCondition);
+
+    /**
+     * Add a PDE for an additional species, to be solved on the same FE mesh as the
+     * PDE passed to the constructor. As for that PDE, the boundary condition must be
+     * of Dirichlet type.
+     *
+     * @param pPde the linear elliptic PDE for the additional species
+     * @param pBoundaryCondition the boundary condition for the additional species
+     * @param rVariableName the name of the dependent variable for the additional species
+     */
+    void AddPde(boost::shared_ptr<AbstractLinearEllipticPde<DIM,DIM> > pPde,
+                boost::shared_ptr<AbstractBoundaryCondition<DIM> > pBoundaryCondition,
+                const std::string& rVariableName);
+
+    /**
+     * @return the number of additional species added using AddPde().
+     */
+    unsigned GetNumAdditionalPdes() const;
+
+    /**
+     * @return the solution of an additional species at the current time step.
+     *
+     * @param index the index of the additional species, in the order in which they were added
+     */
+    Vec GetAdditionalSolution(unsigned index);
+
+    /**
+     * Set mTimeStepsPerSolve.
+     *
+     * @param timeStepsPerSolve the number of time steps between solves of the PDE
+     */
+    void SetTimeStepsPerSolve(unsigned timeStepsPerSolve);
+
+    /**
+     * @return mTimeStepsPerSolve.
+     */
+    unsigned GetTimeStepsPerSolve() const;
+
+    /**
+     * Set mSourceTermChangeTolerance. Between the solves scheduled by SetTimeStepsPerSolve(),
+     * the PDE is then solved as soon as the cells in the elements of the FE mesh have changed
+     * by more than this relative amount since the most recent solve.
+     *
+     * @param sourceTermChangeTolerance the relative change in the number of cells in each element
+     */
+    void SetSourceTermChangeTolerance(double sourceTermChangeTolerance);
+
+    /**
+     * @return mSourceTermChangeTolerance.
+     */
+    double GetSourceTermChangeTolerance() const;
+
     /**
      * Overridden OutputSimulationModifierParameters() method.
      * Output any simulation modifier parameters to file.
@@ -153,6 +305,16 @@ namespace boost
 {
 namespace serialization
 {
+/**
+ * Specify a version number for archive backwards compatibility.
+ */
+template<unsigned DIM>
+struct version<EllipticBoxDomainPdeModifier<DIM> >
+{
+    ///Macro to set the version number of templated archive in known versions of Boost
+    CHASTE_VERSION_CONTENT(3);
+};
+
 template<class Archive, unsigned DIM>
 inline void save_construct_data(
     Archive & ar, const EllipticBoxDomainPdeModifier<DIM> * t, const unsigned int file_version)
@@ -45,7 +45,8 @@ EllipticGrowingDomainPdeModifier<DIM>::EllipticGrowingDomainPdeModifier(boost::s
     : AbstractGrowingDomainPdeModifier<DIM>(pPde,
                                             pBoundaryCondition,
                                             isNeumannBoundaryCondition,
-                                            solution)
+                                            solution),
+      mNumLinearSolverIterations(0)
 {
 }
 
@@ -78,17 +79,31 @@ void EllipticGrowingDomainPdeModifier<DIM>::UpdateAtEndOfTimeStep(AbstractCellPo
         VecCopy(this->mSolution, initial_guess);
         PetscTools::Destroy(this->mSolution);
     }
+    else if (this->mSolution)
+    {
+        /*
+         * Otherwise, if the mesh has changed since a previous solve, then interpolate the previous
+         * solution onto the new mesh using the values stored in CellData (which daughter cells
+         * inherit from their parents) to give an initial guess.
+         */
+        initial_guess = PetscTools::CreateAndSetVec(this->mpFeMesh->GetNumNodes(), 0.0);
+        this->CopyCellDataToSolutionVector(rCellPopulation, initial_guess);
+        PetscTools::Destroy(this->mSolution);
+        this->mSolution = nullptr;
+    }
+    bool has_initial_guess = (previous_solution_size > 0);
 
     // Add the BCs to the BCs container
     std::shared_ptr<BoundaryConditionsContainer<DIM,DIM,1> > p_bcc = this->ConstructBoundaryConditionsContainer();
 
     // Use CellBasedEllipticPdeSolver as cell wise PDE
+    ///\todo Reuse the sparsity pattern, KSP and preconditioner when the FE mesh connectivity is unchanged
     CellBasedEllipticPdeSolver<DIM> solver(this->mpFeMesh,
                                            boost::static_pointer_cast<AbstractLinearEllipticPde<DIM,DIM> >(this->GetPde()).get(),
                                            p_bcc.get());
 
     // If we have an initial guess, use this when solving the system...
-    if (is_previous_solution_size_correct)
+    if (has_initial_guess)
     {
         this->mSolution = solver.Solve(initial_guess);
         PetscTools::Destroy(initial_guess);
@@ -107,6 +122,8 @@ void EllipticGrowingDomainPdeModifier<DIM>::UpdateAtEndOfTimeStep(AbstractCellPo
         }
     }
 
+    mNumLinearSolverIterations = solver.GetLinearSystem()->GetNumIterations();
+
     this->UpdateCellData(rCellPopulation);
 }
 
@@ -142,6 +159,12 @@ std::shared_ptr<BoundaryConditionsContainer<DIM,DIM,1> > EllipticGrowingDomainPd
     return p_bcc;
 }
 
+template<unsigned DIM>
+unsigned EllipticGrowingDomainPdeModifier<DIM>::GetNumLinearSolverIterations() const
+{
+    return mNumLinearSolverIterations;
+}
+
 template<unsigned DIM>
 void EllipticGrowingDomainPdeModifier<DIM>::OutputSimulationModifierParameters(out_stream& rParamsFile)
 {
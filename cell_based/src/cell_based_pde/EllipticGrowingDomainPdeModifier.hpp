@@ -54,6 +54,12 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  * class and is used in the AbstractGrowingDomainPdeModifier method GenerateFeMesh()
  * that is inherited by this class.
  *
+ * When the number of nodes in the finite element mesh is unchanged, the solution at
+ * the previous time step is used as an initial guess for the linear solver. Otherwise
+ * the previous solution, as stored in CellData, is interpolated onto the new mesh.
+ * The linear system, its sparsity pattern, KSP and preconditioner are still built
+ * afresh on every time step.
+ *
  * Examples of PDEs in the source folder that can be solved using this class are
  * CellwiseSourceEllipticPde and UniformSourceEllipticPde.
  */
@@ -64,6 +70,12 @@ class EllipticGrowingDomainPdeModifier : public AbstractGrowingDomainPdeModifier
 
 private:
 
+    /**
+     * The number of iterations taken by the linear solver in the most recent solve
+     * of the PDE. Initialised to zero in the constructor and not archived.
+     */
+    unsigned mNumLinearSolverIterations;
+
     /** Needed for serialization. */
     friend class boost::serialization::access;
     /**
@@ -126,6 +138,11 @@ public:
      */
     virtual std::shared_ptr<BoundaryConditionsContainer<DIM,DIM,1> > ConstructBoundaryConditionsContainer();
 
+    /**
+     * @return mNumLinearSolverIterations.
+     */
+    unsigned GetNumLinearSolverIterations() const;
+
     /**
      * Overridden OutputSimulationModifierParameters() method.
      * Output any simulation modifier parameters to file.
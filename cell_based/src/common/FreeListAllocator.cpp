@@ -0,0 +1,100 @@
+/*
+
+Copyright (c) 2005-2017, University of Oxford.
+All rights reserved.
+
+University of Oxford means the Chancellor, Masters and Scholars of the
+University of Oxford, having an administrative office at Wellington
+Square, Oxford OX1 2JD, UK.
+
+This file is part of Chaste.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+ * Redistributions of source code must retain the above copyright notice,
+   this list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+ * Neither the name of the University of Oxford nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "FreeListAllocator.hpp"
+
+#include <new>
+
+FreeListAllocator::FreeListAllocator(std::size_t blockSize)
+    : mBlockSize(blockSize)
+{
+}
+
+FreeListAllocator::~FreeListAllocator()
+{
+    ReleaseFreeBlocks();
+}
+
+void* FreeListAllocator::Allocate(std::size_t size)
+{
+    if (CanRecycle(size))
+    {
+        void* p_block = mFreeBlocks.back();
+        mFreeBlocks.pop_back();
+        return p_block;
+    }
+    return ::operator new(size);
+}
+
+void FreeListAllocator::Deallocate(void* pBlock, std::size_t size)
+{
+    if (pBlock == nullptr)
+    {
+        return;
+    }
+
+    if (size == mBlockSize)
+    {
+        try
+        {
+            mFreeBlocks.push_back(pBlock);
+            return;
+        }
+        catch (const std::bad_alloc&)
+        {
+            // No room to keep the block, so fall through and return it to the heap
+        }
+    }
+    ::operator delete(pBlock);
+}
+
+bool FreeListAllocator::CanRecycle(std::size_t size) const
+{
+    return (size == mBlockSize) && !mFreeBlocks.empty();
+}
+
+unsigned FreeListAllocator::GetNumFreeBlocks() const
+{
+    return mFreeBlocks.size();
+}
+
+void FreeListAllocator::ReleaseFreeBlocks()
+{
+    for (unsigned i=0; i<mFreeBlocks.size(); i++)
+    {
+        ::operator delete(mFreeBlocks[i]);
+    }
+    mFreeBlocks.clear();
+}
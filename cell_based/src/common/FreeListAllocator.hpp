@@ -0,0 +1,114 @@
+/*
+
+Copyright (c) 2005-2017, University of Oxford.
+All rights reserved.
+
+University of Oxford means the Chancellor, Masters and Scholars of the
+University of Oxford, having an administrative office at Wellington
+Square, Oxford OX1 2JD, UK.
+
+This file is part of Chaste.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+ * Redistributions of source code must retain the above copyright notice,
+   this list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+ * Neither the name of the University of Oxford nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#ifndef FREELISTALLOCATOR_HPP_
+#define FREELISTALLOCATOR_HPP_
+
+#include <cstddef>
+#include <vector>
+
+/**
+ * A simple allocator for objects of a single, fixed size, which recycles the memory
+ * of freed objects rather than returning it to the heap.
+ *
+ * This is intended for use in class-specific operator new and operator delete methods
+ * of objects that are created and destroyed in large numbers during a simulation, such
+ * as Cell objects in a population with constant turnover. Requests for blocks of any
+ * other size (for example from a derived class) are passed straight through to the heap.
+ *
+ * Recycled blocks are only returned to the heap when ReleaseFreeBlocks() is called or
+ * the allocator is destroyed.
+ */
+class FreeListAllocator
+{
+private:
+
+    /** The size in bytes of the blocks managed by this allocator. */
+    std::size_t mBlockSize;
+
+    /** Freed blocks available for reuse. */
+    std::vector<void*> mFreeBlocks;
+
+public:
+
+    /**
+     * Constructor.
+     *
+     * @param blockSize the size in bytes of the blocks managed by this allocator
+     */
+    FreeListAllocator(std::size_t blockSize);
+
+    /**
+     * Destructor, which returns any free blocks to the heap.
+     */
+    ~FreeListAllocator();
+
+    /**
+     * Allocate a block of memory, reusing a freed block if one is available.
+     *
+     * @param size the number of bytes required
+     * @return a pointer to the block
+     */
+    void* Allocate(std::size_t size);
+
+    /**
+     * Free a block of memory previously obtained from Allocate(), keeping it for reuse
+     * if it is of the managed size.
+     *
+     * @param pBlock the block
+     * @param size the number of bytes that were requested when the block was allocated
+     */
+    void Deallocate(void* pBlock, std::size_t size);
+
+    /**
+     * @return whether a request for a block of the given size will be satisfied by
+     * recycling a freed block rather than by allocating from the heap.
+     *
+     * @param size the number of bytes required
+     */
+    bool CanRecycle(std::size_t size) const;
+
+    /**
+     * @return the number of freed blocks currently held for reuse.
+     */
+    unsigned GetNumFreeBlocks() const;
+
+    /**
+     * Return all freed blocks held for reuse to the heap.
+     */
+    void ReleaseFreeBlocks();
+};
+
+#endif /*FREELISTALLOCATOR_HPP_*/
@@ -34,6 +34,9 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 */
 
 #include "PottsMesh.hpp"
+
+#include <algorithm>
+
 #include "RandomNumberGenerator.hpp"
 
 
@@ -42,6 +45,7 @@ PottsMesh<DIM>::PottsMesh(std::vector<Node<DIM>*> nodes,
                           std::vector<PottsElement<DIM>*> pottsElements,
                           std::vector<std::set<unsigned> > vonNeumannNeighbouringNodeIndices,
                           std::vector<std::set<unsigned> > mooreNeighbouringNodeIndices)
+    : mNeighbourTablesAreCurrent(false)
 {
     // Reset member variables and clear mNodes, mElements.
     Clear();
@@ -85,6 +89,7 @@ PottsMesh<DIM>::PottsMesh(std::vector<Node<DIM>*> nodes,
 
 template<unsigned DIM>
 PottsMesh<DIM>::PottsMesh()
+    : mNeighbourTablesAreCurrent(false)
 {
     this->mMeshChangesDuringSimulation = true;
     Clear();
@@ -134,6 +139,7 @@ void PottsMesh<DIM>::Clear()
     this->mNodes.clear();
 
     mDeletedElementIndices.clear();
+    mNeighbourTablesAreCurrent = false;
 
     // Delete neighbour info
     //mVonNeumannNeighbouringNodeIndices.clear();
@@ -207,13 +213,12 @@ double PottsMesh<DIM>::GetSurfaceAreaOfElement(unsigned index)
     double surface_area = 0.0;
     for (unsigned node_index=0; node_index<num_nodes; node_index++)
     {
-        std::set<unsigned> neighbouring_node_indices = GetVonNeumannNeighbouringNodeIndices(p_element->GetNode(node_index)->GetIndex());
+        unsigned global_index = p_element->GetNode(node_index)->GetIndex();
+        unsigned num_neighbours = GetNumVonNeumannNeighbours(global_index);
         unsigned local_edges = 2*DIM;
-        for (std::set<unsigned>::iterator iter = neighbouring_node_indices.begin();
-             iter != neighbouring_node_indices.end();
-             iter++)
+        for (unsigned neighbour=0; neighbour<num_neighbours; neighbour++)
         {
-            std::set<unsigned> neighbouring_node_element_indices = this->mNodes[*iter]->rGetContainingElementIndices();
+            const std::set<unsigned>& neighbouring_node_element_indices = this->mNodes[GetVonNeumannNeighbour(global_index, neighbour)]->rGetContainingElementIndices();
 
             if (!(neighbouring_node_element_indices.empty()) && (local_edges!=0))
             {
@@ -241,6 +246,67 @@ std::set<unsigned> PottsMesh<DIM>::GetVonNeumannNeighbouringNodeIndices(unsigned
     return mVonNeumannNeighbouringNodeIndices[nodeIndex];
 }
 
+template<unsigned DIM>
+void PottsMesh<DIM>::UpdateNeighbourTables()
+{
+    if (mNeighbourTablesAreCurrent)
+    {
+        return;
+    }
+
+    const std::vector<std::set<unsigned> >* p_neighbour_sets[2] = {&mVonNeumannNeighbouringNodeIndices, &mMooreNeighbouringNodeIndices};
+    std::vector<unsigned>* p_offsets[2] = {&mVonNeumannNeighbourOffsets, &mMooreNeighbourOffsets};
+    std::vector<unsigned>* p_tables[2] = {&mVonNeumannNeighbourTable, &mMooreNeighbourTable};
+
+    for (unsigned i=0; i<2; i++)
+    {
+        const std::vector<std::set<unsigned> >& r_sets = *(p_neighbour_sets[i]);
+        p_offsets[i]->resize(r_sets.size() + 1);
+        p_tables[i]->clear();
+
+        (*p_offsets[i])[0] = 0;
+        for (unsigned node_index=0; node_index<r_sets.size(); node_index++)
+        {
+            p_tables[i]->insert(p_tables[i]->end(), r_sets[node_index].begin(), r_sets[node_index].end());
+            (*p_offsets[i])[node_index+1] = p_tables[i]->size();
+        }
+    }
+
+    mNeighbourTablesAreCurrent = true;
+}
+
+template<unsigned DIM>
+unsigned PottsMesh<DIM>::GetNumMooreNeighbours(unsigned nodeIndex)
+{
+    UpdateNeighbourTables();
+    assert(nodeIndex + 1 < mMooreNeighbourOffsets.size());
+    return mMooreNeighbourOffsets[nodeIndex+1] - mMooreNeighbourOffsets[nodeIndex];
+}
+
+template<unsigned DIM>
+unsigned PottsMesh<DIM>::GetMooreNeighbour(unsigned nodeIndex, unsigned neighbourIndex)
+{
+    UpdateNeighbourTables();
+    assert(neighbourIndex < GetNumMooreNeighbours(nodeIndex));
+    return mMooreNeighbourTable[mMooreNeighbourOffsets[nodeIndex] + neighbourIndex];
+}
+
+template<unsigned DIM>
+unsigned PottsMesh<DIM>::GetNumVonNeumannNeighbours(unsigned nodeIndex)
+{
+    UpdateNeighbourTables();
+    assert(nodeIndex + 1 < mVonNeumannNeighbourOffsets.size());
+    return mVonNeumannNeighbourOffsets[nodeIndex+1] - mVonNeumannNeighbourOffsets[nodeIndex];
+}
+
+template<unsigned DIM>
+unsigned PottsMesh<DIM>::GetVonNeumannNeighbour(unsigned nodeIndex, unsigned neighbourIndex)
+{
+    UpdateNeighbourTables();
+    assert(neighbourIndex < GetNumVonNeumannNeighbours(nodeIndex));
+    return mVonNeumannNeighbourTable[mVonNeumannNeighbourOffsets[nodeIndex] + neighbourIndex];
+}
+
 template<unsigned DIM>
 void PottsMesh<DIM>::DeleteElement(unsigned index)
 {
@@ -293,6 +359,7 @@ void PottsMesh<DIM>::DeleteNode(unsigned index)
     }
 
     // Remove from connectivity
+    mNeighbourTablesAreCurrent = false;
     mVonNeumannNeighbouringNodeIndices[index].clear();
     mMooreNeighbouringNodeIndices[index].clear();
 
@@ -529,45 +596,51 @@ unsigned PottsMesh<DIM>::AddElement(PottsElement<DIM>* pNewElement)
 template<unsigned DIM>
 std::set<unsigned> PottsMesh<DIM>::GetNeighbouringElementIndices(unsigned elementIndex)
 {
+    std::vector<unsigned> neighbouring_element_indices;
+    GetNeighbouringElementIndices(elementIndex, neighbouring_element_indices);
+
+    return std::set<unsigned>(neighbouring_element_indices.begin(), neighbouring_element_indices.end());
+}
+
+template<unsigned DIM>
+void PottsMesh<DIM>::GetNeighbouringElementIndices(unsigned elementIndex, std::vector<unsigned>& rNeighbouringElementIndices)
+{
+    rNeighbouringElementIndices.clear();
+
     // Helper variables
     PottsElement<DIM>* p_element = this->GetElement(elementIndex);
     unsigned num_nodes = p_element->GetNumNodes();
 
-    // Create a set of neighbouring element indices
-    std::set<unsigned> neighbouring_element_indices;
-
     // Loop over nodes owned by this element
     for (unsigned local_index=0; local_index<num_nodes; local_index++)
     {
-        // Get a pointer to this node
-        Node<DIM>* p_node = p_element->GetNode(local_index);
-
-        // Find the indices of the elements owned by neighbours of this node
+        unsigned node_index = p_element->GetNodeGlobalIndex(local_index);
 
         // Loop over neighbouring nodes. Only want Von Neuman neighbours (i.e N,S,E,W) as need to share an edge
-        std::set<unsigned> neighbouring_node_indices = GetVonNeumannNeighbouringNodeIndices(p_node->GetIndex());
-
-         // Iterate over these neighbouring nodes
-         for (std::set<unsigned>::iterator neighbour_iter = neighbouring_node_indices.begin();
-              neighbour_iter != neighbouring_node_indices.end();
-              ++neighbour_iter)
-         {
-             std::set<unsigned> neighbouring_node_containing_elem_indices = this->GetNode(*neighbour_iter)->rGetContainingElementIndices();
-
-             assert(neighbouring_node_containing_elem_indices.size()<2); // Either in element or in medium
-
-             if (neighbouring_node_containing_elem_indices.size()==1) // Node is in an element
-             {
-                 // Add this element to the neighbouring elements set
-                 neighbouring_element_indices.insert(*(neighbouring_node_containing_elem_indices.begin()));
-             }
-         }
-    }
+        unsigned num_neighbours = GetNumVonNeumannNeighbours(node_index);
+        for (unsigned neighbour=0; neighbour<num_neighbours; neighbour++)
+        {
+            const std::set<unsigned>& r_neighbouring_node_containing_elem_indices = this->GetNode(GetVonNeumannNeighbour(node_index, neighbour))->rGetContainingElementIndices();
+
+            assert(r_neighbouring_node_containing_elem_indices.size()<2); // Either in element or in medium
+
+            if (r_neighbouring_node_containing_elem_indices.size()==1) // Node is in an element
+            {
+                unsigned neighbouring_elem_index = *(r_neighbouring_node_containing_elem_indices.begin());
 
-    // Lastly remove this element's index from the set of neighbouring element indices
-    neighbouring_element_indices.erase(elementIndex);
+                // Exclude this element's own index
+                if (neighbouring_elem_index != elementIndex)
+                {
+                    rNeighbouringElementIndices.push_back(neighbouring_elem_index);
+                }
+            }
+        }
+    }
 
-    return neighbouring_element_indices;
+    // Sort and remove duplicates
+    std::sort(rNeighbouringElementIndices.begin(), rNeighbouringElementIndices.end());
+    rNeighbouringElementIndices.erase(std::unique(rNeighbouringElementIndices.begin(), rNeighbouringElementIndices.end()),
+                                      rNeighbouringElementIndices.end());
 }
 
 template<unsigned DIM>
@@ -635,6 +708,7 @@ void PottsMesh<DIM>::ConstructFromMeshReader(AbstractMeshReader<DIM, DIM>& rMesh
     {
         mMooreNeighbouringNodeIndices.resize(num_nodes);
     }
+    mNeighbourTablesAreCurrent = false;
 }
 
 // Explicit instantiation
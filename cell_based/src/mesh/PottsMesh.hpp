@@ -80,6 +80,32 @@ protected:
     /** Vector of set of Moore neighbours for each node. */
     std::vector< std::set<unsigned> > mMooreNeighbouringNodeIndices;
 
+    /**
+     * Flat (compressed row) copy of mVonNeumannNeighbouringNodeIndices: the neighbours of
+     * node i are stored contiguously in mVonNeumannNeighbourTable, starting at entry
+     * mVonNeumannNeighbourOffsets[i] and ending before mVonNeumannNeighbourOffsets[i+1].
+     * Rebuilt from the sets whenever the connectivity changes.
+     */
+    std::vector<unsigned> mVonNeumannNeighbourOffsets;
+
+    /** Flat table of Von Neumann neighbours; see mVonNeumannNeighbourOffsets. */
+    std::vector<unsigned> mVonNeumannNeighbourTable;
+
+    /** Offsets into mMooreNeighbourTable; see mVonNeumannNeighbourOffsets. */
+    std::vector<unsigned> mMooreNeighbourOffsets;
+
+    /** Flat table of Moore neighbours; see mVonNeumannNeighbourOffsets. */
+    std::vector<unsigned> mMooreNeighbourTable;
+
+    /** Whether the flat neighbour tables are consistent with the neighbour sets. */
+    bool mNeighbourTablesAreCurrent;
+
+    /**
+     * Rebuild the flat neighbour tables from mVonNeumannNeighbouringNodeIndices and
+     * mMooreNeighbouringNodeIndices, if they are out of date.
+     */
+    void UpdateNeighbourTables();
+
     /**
      * Solve node mapping method. This overridden method is required
      * as it is pure virtual in the base class.
@@ -284,6 +310,43 @@ public:
      */
     std::set<unsigned> GetVonNeumannNeighbouringNodeIndices(unsigned nodeIndex);
 
+    /**
+     * Get the number of Moore neighbours of a node. Together with GetMooreNeighbour(),
+     * this provides access to the neighbours without constructing a set, and
+     * random access to any given neighbour.
+     *
+     * @param nodeIndex global index of the node
+     * @return the number of neighbouring nodes in the Moore neighbourhood
+     */
+    unsigned GetNumMooreNeighbours(unsigned nodeIndex);
+
+    /**
+     * Get one of the Moore neighbours of a node. Neighbours are numbered in increasing
+     * order of global index, as in GetMooreNeighbouringNodeIndices().
+     *
+     * @param nodeIndex global index of the node
+     * @param neighbourIndex which neighbour to return, less than GetNumMooreNeighbours(nodeIndex)
+     * @return the global index of the neighbouring node
+     */
+    unsigned GetMooreNeighbour(unsigned nodeIndex, unsigned neighbourIndex);
+
+    /**
+     * Get the number of Von Neumann neighbours of a node; see GetNumMooreNeighbours().
+     *
+     * @param nodeIndex global index of the node
+     * @return the number of neighbouring nodes in the Von Neumann neighbourhood
+     */
+    unsigned GetNumVonNeumannNeighbours(unsigned nodeIndex);
+
+    /**
+     * Get one of the Von Neumann neighbours of a node; see GetMooreNeighbour().
+     *
+     * @param nodeIndex global index of the node
+     * @param neighbourIndex which neighbour to return, less than GetNumVonNeumannNeighbours(nodeIndex)
+     * @return the global index of the neighbouring node
+     */
+    unsigned GetVonNeumannNeighbour(unsigned nodeIndex, unsigned neighbourIndex);
+
     /**
      * Mark a node as deleted. Note that in a Potts mesh this requires the elements and connectivity to be updated accordingley.
      *
@@ -335,6 +398,16 @@ public:
      */
     std::set<unsigned> GetNeighbouringElementIndices(unsigned elementIndex);
 
+    /**
+     * Given an element, find the indices of its neighbouring elements, in increasing order.
+     * This avoids constructing a set, and does not allocate memory if the vector
+     * is reused and already large enough.
+     *
+     * @param elementIndex global index of the element
+     * @param rNeighbouringElementIndices vector to be filled with the neighbouring element indices
+     */
+    void GetNeighbouringElementIndices(unsigned elementIndex, std::vector<unsigned>& rNeighbouringElementIndices);
+
     //////////////////////////////////////////////////////////////////////
     //                         Nested classes                           //
     //////////////////////////////////////////////////////////////////////
@@ -442,6 +442,20 @@ void AbstractCellPopulation<ELEMENT_DIM, SPACE_DIM>::SetDefaultCellMutationState
     }
 }
 
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+void AbstractCellPopulation<ELEMENT_DIM, SPACE_DIM>::FillNeighbouringNodeIndices(unsigned index, std::vector<unsigned>& rNeighbourIndices)
+{
+    std::set<unsigned> neighbour_indices = this->GetNeighbouringNodeIndices(index);
+    rNeighbourIndices.assign(neighbour_indices.begin(), neighbour_indices.end());
+}
+
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+void AbstractCellPopulation<ELEMENT_DIM, SPACE_DIM>::FillNeighbouringLocationIndices(CellPtr pCell, std::vector<unsigned>& rNeighbourIndices)
+{
+    std::set<unsigned> neighbour_indices = this->GetNeighbouringLocationIndices(pCell);
+    rNeighbourIndices.assign(neighbour_indices.begin(), neighbour_indices.end());
+}
+
 template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
 c_vector<double, SPACE_DIM> AbstractCellPopulation<ELEMENT_DIM, SPACE_DIM>::GetCentroidOfCellPopulation()
 {
@@ -577,6 +577,32 @@ public:
      */
     virtual std::set<unsigned> GetNeighbouringLocationIndices(CellPtr pCell)=0;
 
+    /**
+     * Given a node index, fill a vector with the neighbouring node indices, in increasing
+     * order. This gives the same indices as GetNeighbouringNodeIndices(), but is intended
+     * for code that queries neighbours for every cell at every time step: subclasses
+     * override it to avoid constructing a set, so that reusing the same vector for each
+     * query does not allocate memory.
+     *
+     * The default implementation copies the result of GetNeighbouringNodeIndices().
+     *
+     * @param index the node index
+     * @param rNeighbourIndices vector to be filled with the neighbouring node indices
+     */
+    virtual void FillNeighbouringNodeIndices(unsigned index, std::vector<unsigned>& rNeighbourIndices);
+
+    /**
+     * Given a cell, fill a vector with the location indices corresponding to neighbouring
+     * cells, in increasing order. This is to GetNeighbouringLocationIndices() as
+     * FillNeighbouringNodeIndices() is to GetNeighbouringNodeIndices().
+     *
+     * The default implementation copies the result of GetNeighbouringLocationIndices().
+     *
+     * @param pCell a cell
+     * @param rNeighbourIndices vector to be filled with the neighbouring location indices
+     */
+    virtual void FillNeighbouringLocationIndices(CellPtr pCell, std::vector<unsigned>& rNeighbourIndices);
+
     /**
      * @return the centroid of the cell population.
      */
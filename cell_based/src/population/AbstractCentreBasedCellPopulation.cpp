@@ -191,6 +191,13 @@ std::set<unsigned> AbstractCentreBasedCellPopulation<ELEMENT_DIM,SPACE_DIM>::Get
     return this->GetNeighbouringNodeIndices(node_index);
 }
 
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+void AbstractCentreBasedCellPopulation<ELEMENT_DIM,SPACE_DIM>::FillNeighbouringLocationIndices(CellPtr pCell, std::vector<unsigned>& rNeighbourIndices)
+{
+    unsigned node_index = this->GetLocationIndexUsingCell(pCell);
+    this->FillNeighbouringNodeIndices(node_index, rNeighbourIndices);
+}
+
 template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
 void AbstractCentreBasedCellPopulation<ELEMENT_DIM, SPACE_DIM>::CheckForStepSizeException(unsigned nodeIndex, c_vector<double,SPACE_DIM>& rDisplacement, double dt)
 {
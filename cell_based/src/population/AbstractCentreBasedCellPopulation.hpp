@@ -227,6 +227,14 @@ public:
      */
     virtual std::set<unsigned> GetNeighbouringLocationIndices(CellPtr pCell);
 
+    /**
+     * Overridden FillNeighbouringLocationIndices() method.
+     *
+     * @param pCell a cell
+     * @param rNeighbourIndices vector to be filled with the neighbouring location indices
+     */
+    virtual void FillNeighbouringLocationIndices(CellPtr pCell, std::vector<unsigned>& rNeighbourIndices);
+
     /**
      * Checks whether a given node displacement violates the movement threshold
      * for this population. If so, a stepSizeException is generated that contains
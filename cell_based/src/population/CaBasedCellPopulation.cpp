@@ -170,21 +170,30 @@ unsigned CaBasedCellPopulation<DIM>::GetNumNodes()
 template<unsigned DIM>
 std::set<unsigned> CaBasedCellPopulation<DIM>::GetNeighbouringLocationIndices(CellPtr pCell)
 {
+    std::vector<unsigned> neighbour_indices;
+    FillNeighbouringLocationIndices(pCell, neighbour_indices);
+
+    return std::set<unsigned>(neighbour_indices.begin(), neighbour_indices.end());
+}
+
+template<unsigned DIM>
+void CaBasedCellPopulation<DIM>::FillNeighbouringLocationIndices(CellPtr pCell, std::vector<unsigned>& rNeighbourIndices)
+{
+    rNeighbourIndices.clear();
+
     unsigned index = this->GetLocationIndexUsingCell(pCell);
-    std::set<unsigned> candidates = static_cast<PottsMesh<DIM>& >((this->mrMesh)).GetMooreNeighbouringNodeIndices(index);
+    PottsMesh<DIM>& r_mesh = static_cast<PottsMesh<DIM>& >((this->mrMesh));
 
-    std::set<unsigned> neighbour_indices;
-    for (std::set<unsigned>::iterator iter = candidates.begin();
-         iter != candidates.end();
-         ++iter)
+    // The flat neighbour table stores the Moore neighbours in increasing order of index
+    unsigned num_candidates = r_mesh.GetNumMooreNeighbours(index);
+    for (unsigned i=0; i<num_candidates; i++)
     {
-        if (!IsSiteAvailable(*iter, pCell))
+        unsigned candidate = r_mesh.GetMooreNeighbour(index, i);
+        if (!IsSiteAvailable(candidate, pCell))
         {
-            neighbour_indices.insert(*iter);
+            rNeighbourIndices.push_back(candidate);
         }
     }
-
-    return neighbour_indices;
 }
 
 template<unsigned DIM>
@@ -286,8 +295,15 @@ void CaBasedCellPopulation<DIM>::UpdateCellLocations(double dt)
      * Here we loop over the nodes and calculate the probability of moving
      * and then select the node to move to.
      */
+    PottsMesh<DIM>& r_mesh = static_cast<PottsMesh<DIM>& >(this->mrMesh);
+    RandomNumberGenerator* p_gen = RandomNumberGenerator::Instance();
+
     if (!(this->mUpdateRuleCollection.empty()))
     {
+        // Reuse these buffers across cells to avoid repeated allocation during the sweep
+        std::vector<double> neighbouring_node_propensities;
+        std::vector<unsigned> neighbouring_node_indices_vector;
+
         // Iterate over cells
         ///\todo make this sweep random
         for (std::list<CellPtr>::iterator cell_iter = this->mCells.begin();
@@ -298,24 +314,22 @@ void CaBasedCellPopulation<DIM>::UpdateCellLocations(double dt)
             unsigned node_index = this->GetLocationIndexUsingCell(*cell_iter);
 
             // Find a random available neighbouring node to overwrite current site
-            std::set<unsigned> neighbouring_node_indices = static_cast<PottsMesh<DIM>& >((this->mrMesh)).GetMooreNeighbouringNodeIndices(node_index);
-            std::vector<double> neighbouring_node_propensities;
-            std::vector<unsigned> neighbouring_node_indices_vector;
+            unsigned num_neighbours = r_mesh.GetNumMooreNeighbours(node_index);
+            neighbouring_node_propensities.clear();
+            neighbouring_node_indices_vector.clear();
 
-            if (!neighbouring_node_indices.empty())
+            if (num_neighbours > 0)
             {
-                unsigned num_neighbours = neighbouring_node_indices.size();
                 double probability_of_not_moving = 1.0;
 
-                for (std::set<unsigned>::iterator iter = neighbouring_node_indices.begin();
-                     iter != neighbouring_node_indices.end();
-                     ++iter)
+                for (unsigned neighbour=0; neighbour<num_neighbours; neighbour++)
                 {
                     double probability_of_moving = 0.0;
 
-                    neighbouring_node_indices_vector.push_back(*iter);
+                    unsigned neighbour_index = r_mesh.GetMooreNeighbour(node_index, neighbour);
+                    neighbouring_node_indices_vector.push_back(neighbour_index);
 
-                    if (IsSiteAvailable(*iter, *cell_iter))
+                    if (IsSiteAvailable(neighbour_index, *cell_iter))
                     {
                         // Iterating over the update rule
                         for (typename std::vector<boost::shared_ptr<AbstractUpdateRule<DIM> > >::iterator iter_rule = this->mUpdateRuleCollection.begin();
@@ -323,7 +337,7 @@ void CaBasedCellPopulation<DIM>::UpdateCellLocations(double dt)
                              ++iter_rule)
                         {
                             // This static cast is fine, since we assert the update rule must be a CA update rule in AddUpdateRule()
-                            double p = (boost::static_pointer_cast<AbstractCaUpdateRule<DIM> >(*iter_rule))->EvaluateProbability(node_index, *iter, *this, dt, 1, *cell_iter);
+                            double p = (boost::static_pointer_cast<AbstractCaUpdateRule<DIM> >(*iter_rule))->EvaluateProbability(node_index, neighbour_index, *this, dt, 1, *cell_iter);
                             probability_of_moving += p;
                             if (probability_of_moving < 0)
                             {
@@ -350,7 +364,6 @@ void CaBasedCellPopulation<DIM>::UpdateCellLocations(double dt)
                 }
 
                 // Sample random number to specify which move to make
-                RandomNumberGenerator* p_gen = RandomNumberGenerator::Instance();
                 double random_number = p_gen->ranf();
 
                 double total_probability = 0.0;
@@ -385,7 +398,6 @@ void CaBasedCellPopulation<DIM>::UpdateCellLocations(double dt)
     {
         assert(mLatticeCarryingCapacity == 1);
 
-        RandomNumberGenerator* p_gen = RandomNumberGenerator::Instance();
         unsigned num_nodes = this->mrMesh.GetNumNodes();
 
         // Randomly permute mUpdateRuleCollection if specified
@@ -410,21 +422,12 @@ void CaBasedCellPopulation<DIM>::UpdateCellLocations(double dt)
             }
 
             // Find a random available neighbouring node to switch cells with the current site
-            std::set<unsigned> neighbouring_node_indices = static_cast<PottsMesh<DIM>& >((this->mrMesh)).GetMooreNeighbouringNodeIndices(node_index);
+            unsigned num_neighbours = r_mesh.GetNumMooreNeighbours(node_index);
 
-            unsigned neighbour_location_index;
-
-            if (!neighbouring_node_indices.empty())
+            if (num_neighbours > 0)
             {
-                unsigned num_neighbours = neighbouring_node_indices.size();
                 unsigned chosen_neighbour = p_gen->randMod(num_neighbours);
-
-                std::set<unsigned>::iterator neighbour_iter = neighbouring_node_indices.begin();
-                for (unsigned j=0; j<chosen_neighbour; j++)
-                {
-                    neighbour_iter++;
-                }
-                neighbour_location_index = *neighbour_iter;
+                unsigned neighbour_location_index = r_mesh.GetMooreNeighbour(node_index, chosen_neighbour);
 
                 bool is_cell_on_node_index = mAvailableSpaces[node_index] == 0 ? true : false;
                 bool is_cell_on_neighbour_location_index = mAvailableSpaces[neighbour_location_index] == 0 ? true : false;
@@ -635,6 +638,8 @@ void CaBasedCellPopulation<DIM>::WriteVtkResultsToFile(const std::string& rDirec
         num_cell_data_items = this->Begin()->GetCellData()->GetNumItems();
         cell_data_names = this->Begin()->GetCellData()->GetKeys();
     }
+    std::vector<unsigned> cell_data_indices = CellData::GetItemIndices(cell_data_names);
+
     std::vector<std::vector<double> > cell_data;
     for (unsigned var=0; var<num_cell_data_items; var++)
     {
@@ -730,7 +735,7 @@ void CaBasedCellPopulation<DIM>::WriteVtkResultsToFile(const std::string& rDirec
     {
         for (unsigned var=0; var<num_cell_data_items; var++)
         {
-            cell_data[var][cell_index] = cell_iter->GetCellData()->GetItem(cell_data_names[var]);
+            cell_data[var][cell_index] = cell_iter->GetCellData()->GetItem(cell_data_indices[var]);
         }
         cell_index++;
     }
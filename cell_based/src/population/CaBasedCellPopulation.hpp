@@ -229,6 +229,14 @@ public:
      */
     std::set<unsigned> GetNeighbouringLocationIndices(CellPtr pCell);
 
+    /**
+     * Overridden FillNeighbouringLocationIndices() method.
+     *
+     * @param pCell a cell
+     * @param rNeighbourIndices vector to be filled with the neighbouring location indices
+     */
+    void FillNeighbouringLocationIndices(CellPtr pCell, std::vector<unsigned>& rNeighbourIndices);
+
     /**
      * Overridden GetLocationOfCellCentre() method.
      * Find where a given cell is in space.
@@ -33,6 +33,8 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 */
 
+#include <algorithm>
+
 #include "MeshBasedCellPopulation.hpp"
 #include "VtkMeshWriter.hpp"
 #include "CellBasedEventHandler.hpp"
@@ -607,6 +609,7 @@ void MeshBasedCellPopulation<ELEMENT_DIM,SPACE_DIM>::WriteVtkResultsToFile(const
     // When outputting any CellData, we assume that the first cell is representative of all cells
     unsigned num_cell_data_items = this->Begin()->GetCellData()->GetNumItems();
     std::vector<std::string> cell_data_names = this->Begin()->GetCellData()->GetKeys();
+    std::vector<unsigned> cell_data_indices = CellData::GetItemIndices(cell_data_names);
 
     std::vector<std::vector<double> > cell_data;
     for (unsigned var=0; var<num_cell_data_items; var++)
@@ -661,7 +664,7 @@ void MeshBasedCellPopulation<ELEMENT_DIM,SPACE_DIM>::WriteVtkResultsToFile(const
 
             for (unsigned var=0; var<num_cell_data_items; var++)
             {
-                cell_data[var][node_index] = cell_iter->GetCellData()->GetItem(cell_data_names[var]);
+                cell_data[var][node_index] = cell_iter->GetCellData()->GetItem(cell_data_indices[var]);
             }
         }
         for (unsigned var=0; var<num_cell_data_items; var++)
@@ -737,7 +740,7 @@ void MeshBasedCellPopulation<ELEMENT_DIM,SPACE_DIM>::WriteVtkResultsToFile(const
 
             for (unsigned var=0; var<num_cell_data_items; var++)
             {
-                cell_data[var][elem_index] = p_cell->GetCellData()->GetItem(cell_data_names[var]);
+                cell_data[var][elem_index] = p_cell->GetCellData()->GetItem(cell_data_indices[var]);
             }
         }
 
@@ -1193,11 +1196,21 @@ double MeshBasedCellPopulation<ELEMENT_DIM,SPACE_DIM>::GetWidth(const unsigned&
 template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
 std::set<unsigned> MeshBasedCellPopulation<ELEMENT_DIM,SPACE_DIM>::GetNeighbouringNodeIndices(unsigned index)
 {
+    std::vector<unsigned> neighbouring_node_indices;
+    this->FillNeighbouringNodeIndices(index, neighbouring_node_indices);
+
+    return std::set<unsigned>(neighbouring_node_indices.begin(), neighbouring_node_indices.end());
+}
+
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+void MeshBasedCellPopulation<ELEMENT_DIM,SPACE_DIM>::FillNeighbouringNodeIndices(unsigned index, std::vector<unsigned>& rNeighbourIndices)
+{
+    rNeighbourIndices.clear();
+
     // Get pointer to this node
     Node<SPACE_DIM>* p_node = this->mrMesh.GetNode(index);
 
     // Loop over containing elements
-    std::set<unsigned> neighbouring_node_indices;
     for (typename Node<SPACE_DIM>::ContainingElementIterator elem_iter = p_node->ContainingElementsBegin();
          elem_iter != p_node->ContainingElementsEnd();
          ++elem_iter)
@@ -1208,15 +1221,18 @@ std::set<unsigned> MeshBasedCellPopulation<ELEMENT_DIM,SPACE_DIM>::GetNeighbouri
         // Loop over nodes contained in this element
         for (unsigned i=0; i<p_element->GetNumNodes(); i++)
         {
-            // Get index of this node and add its index to the set if not the original node
+            // Get index of this node and add its index if not the original node
             unsigned node_index = p_element->GetNodeGlobalIndex(i);
             if (node_index != index)
             {
-                neighbouring_node_indices.insert(node_index);
+                rNeighbourIndices.push_back(node_index);
             }
         }
     }
-    return neighbouring_node_indices;
+
+    // Sort and remove duplicates
+    std::sort(rNeighbourIndices.begin(), rNeighbourIndices.end());
+    rNeighbourIndices.erase(std::unique(rNeighbourIndices.begin(), rNeighbourIndices.end()), rNeighbourIndices.end());
 }
 
 template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
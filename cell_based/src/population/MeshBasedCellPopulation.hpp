@@ -572,6 +572,14 @@ public:
      */
     std::set<unsigned> GetNeighbouringNodeIndices(unsigned index);
 
+    /**
+     * Overridden FillNeighbouringNodeIndices() method.
+     *
+     * @param index the node index
+     * @param rNeighbourIndices vector to be filled with the neighbouring node indices
+     */
+    void FillNeighbouringNodeIndices(unsigned index, std::vector<unsigned>& rNeighbourIndices);
+
     /**
      * Populate mSpringRestLengths by looping over all springs and calculating the current length
      */
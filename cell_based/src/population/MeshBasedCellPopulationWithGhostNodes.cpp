@@ -228,25 +228,30 @@ void MeshBasedCellPopulationWithGhostNodes<DIM>::UpdateGhostNodesAfterReMesh(Nod
 
 template<unsigned DIM>
 std::set<unsigned> MeshBasedCellPopulationWithGhostNodes<DIM>::GetNeighbouringLocationIndices(CellPtr pCell)
+{
+    std::vector<unsigned> neighbour_indices;
+    this->FillNeighbouringLocationIndices(pCell, neighbour_indices);
+
+    return std::set<unsigned>(neighbour_indices.begin(), neighbour_indices.end());
+}
+
+template<unsigned DIM>
+void MeshBasedCellPopulationWithGhostNodes<DIM>::FillNeighbouringLocationIndices(CellPtr pCell, std::vector<unsigned>& rNeighbourIndices)
 {
     unsigned node_index = this->GetLocationIndexUsingCell(pCell);
-    std::set<unsigned> neighbour_indices = this->GetNeighbouringNodeIndices(node_index);
+    this->FillNeighbouringNodeIndices(node_index, rNeighbourIndices);
 
-    // Remove ghost nodes from the neighbour indices
-    for (std::set<unsigned>::iterator iter = neighbour_indices.begin();
-         iter != neighbour_indices.end();)
+    // Remove ghost nodes from the neighbour indices, preserving their order
+    unsigned num_real_neighbours = 0;
+    for (unsigned i=0; i<rNeighbourIndices.size(); i++)
     {
-        if (this->IsGhostNode(*iter))
+        if (!this->IsGhostNode(rNeighbourIndices[i]))
         {
-            neighbour_indices.erase(iter++);
-        }
-        else
-        {
-            ++iter;
+            rNeighbourIndices[num_real_neighbours] = rNeighbourIndices[i];
+            num_real_neighbours++;
         }
     }
-
-    return neighbour_indices;
+    rNeighbourIndices.resize(num_real_neighbours);
 }
 
 template<unsigned DIM>
@@ -167,6 +167,14 @@ public:
      */
     std::set<unsigned> GetNeighbouringLocationIndices(CellPtr pCell);
 
+    /**
+     * Overridden FillNeighbouringLocationIndices() method.
+     *
+     * @param pCell a cell
+     * @param rNeighbourIndices vector to be filled with the neighbouring location indices
+     */
+    void FillNeighbouringLocationIndices(CellPtr pCell, std::vector<unsigned>& rNeighbourIndices);
+
     /**
      * Applies the appropriate force to each ghost node in the population.
      * Called by AbstractNumericalMethod.
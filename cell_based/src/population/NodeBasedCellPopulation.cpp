@@ -33,6 +33,8 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 */
 
+#include <algorithm>
+
 #include "NodeBasedCellPopulation.hpp"
 #include "MathsCustomFunctions.hpp"
 #include "VtkMeshWriter.hpp"
@@ -47,7 +49,8 @@ NodeBasedCellPopulation<DIM>::NodeBasedCellPopulation(NodesOnlyMesh<DIM>& rMesh,
       mDeleteMesh(deleteMesh),
       mUseVariableRadii(false),
       mLoadBalanceMesh(false),
-      mLoadBalanceFrequency(100)
+      mLoadBalanceFrequency(100),
+      mSpatialSortFrequency(0)
 {
     mpNodesOnlyMesh = static_cast<NodesOnlyMesh<DIM>* >(&(this->mrMesh));
 
@@ -63,7 +66,8 @@ NodeBasedCellPopulation<DIM>::NodeBasedCellPopulation(NodesOnlyMesh<DIM>& rMesh)
       mDeleteMesh(true),
       mUseVariableRadii(false), // will be set by serialize() method
       mLoadBalanceMesh(false),
-      mLoadBalanceFrequency(100)
+      mLoadBalanceFrequency(100),
+      mSpatialSortFrequency(0)
 {
     mpNodesOnlyMesh = static_cast<NodesOnlyMesh<DIM>* >(&(this->mrMesh));
 }
@@ -150,6 +154,14 @@ void NodeBasedCellPopulation<DIM>::Update(bool hasHadBirthsOrDeaths)
 {
     UpdateCellProcessLocation();
 
+    if (mSpatialSortFrequency > 0)
+    {
+        if ((SimulationTime::Instance()->GetTimeStepsElapsed() % mSpatialSortFrequency) == 0)
+        {
+            SortNodesAndCellsAlongSpaceFillingCurve();
+        }
+    }
+
     mpNodesOnlyMesh->UpdateBoxCollection();
 
     if (mLoadBalanceMesh)
@@ -177,11 +189,12 @@ void NodeBasedCellPopulation<DIM>::Update(bool hasHadBirthsOrDeaths)
      */
     if (mUseVariableRadii)
     {
+        unsigned radius_index = CellData::GetItemIndex("Radius");
         for (typename AbstractCellPopulation<DIM>::Iterator cell_iter = this->Begin();
              cell_iter != this->End();
              ++cell_iter)
         {
-            double cell_radius = cell_iter->GetCellData()->GetItem("Radius");
+            double cell_radius = cell_iter->GetCellData()->GetItem(radius_index);
             unsigned node_index = this->GetLocationIndexUsingCell(*cell_iter);
             this->GetNode(node_index)->SetRadius(cell_radius);
         }
@@ -349,6 +362,43 @@ void NodeBasedCellPopulation<DIM>::SetLoadBalanceFrequency(unsigned loadBalanceF
     mLoadBalanceFrequency = loadBalanceFrequency;
 }
 
+template<unsigned DIM>
+void NodeBasedCellPopulation<DIM>::SetSpatialSortFrequency(unsigned spatialSortFrequency)
+{
+    mSpatialSortFrequency = spatialSortFrequency;
+}
+
+template<unsigned DIM>
+unsigned NodeBasedCellPopulation<DIM>::GetSpatialSortFrequency() const
+{
+    return mSpatialSortFrequency;
+}
+
+template<unsigned DIM>
+void NodeBasedCellPopulation<DIM>::SortNodesAndCellsAlongSpaceFillingCurve()
+{
+    mpNodesOnlyMesh->ReorderNodesAlongSpaceFillingCurve();
+
+    // Place each cell at the local storage position of its node
+    std::vector<CellPtr> cells_in_node_order(mpNodesOnlyMesh->GetNumAllNodes());
+    for (std::list<CellPtr>::iterator it = this->mCells.begin();
+         it != this->mCells.end();
+         ++it)
+    {
+        unsigned local_index = mpNodesOnlyMesh->SolveNodeMapping(this->GetLocationIndexUsingCell(*it));
+        cells_in_node_order[local_index] = *it;
+    }
+
+    this->mCells.clear();
+    for (unsigned i=0; i<cells_in_node_order.size(); i++)
+    {
+        if (cells_in_node_order[i])
+        {
+            this->mCells.push_back(cells_in_node_order[i]);
+        }
+    }
+}
+
 template<unsigned DIM>
 double NodeBasedCellPopulation<DIM>::GetWidth(const unsigned& rDimension)
 {
@@ -372,14 +422,23 @@ c_vector<double, DIM> NodeBasedCellPopulation<DIM>::GetSizeOfCellPopulation()
 template<unsigned DIM>
 std::set<unsigned> NodeBasedCellPopulation<DIM>::GetNodesWithinNeighbourhoodRadius(unsigned index, double neighbourhoodRadius)
 {
+    std::vector<unsigned> neighbouring_node_indices;
+    FillNodesWithinNeighbourhoodRadius(index, neighbourhoodRadius, neighbouring_node_indices);
+
+    return std::set<unsigned>(neighbouring_node_indices.begin(), neighbouring_node_indices.end());
+}
+
+template<unsigned DIM>
+void NodeBasedCellPopulation<DIM>::FillNodesWithinNeighbourhoodRadius(unsigned index, double neighbourhoodRadius, std::vector<unsigned>& rNeighbourIndices)
+{
+    rNeighbourIndices.clear();
+
     // Check neighbourhoodRadius is less than the interaction radius. If not you wont return all the correct nodes
     if (neighbourhoodRadius > mpNodesOnlyMesh->GetMaximumInteractionDistance())
     {
         EXCEPTION("neighbourhoodRadius should be less than or equal to the  the maximum interaction radius defined on the NodesOnlyMesh");
     }
 
-    std::set<unsigned> neighbouring_node_indices;
-
     // Get location
     Node<DIM>* p_node_i = this->GetNode(index);
     const c_vector<double, DIM>& r_node_i_location = p_node_i->rGetLocation();
@@ -416,19 +475,30 @@ std::set<unsigned> NodeBasedCellPopulation<DIM>::GetNodesWithinNeighbourhoodRadi
             // of cell i
             if (distance_between_nodes <= neighbourhoodRadius)// + DBL_EPSILSON)
             {
-                // ...then add this node index to the set of neighbouring node indices
-                neighbouring_node_indices.insert((*iter));
+                // ...then add this node index to the neighbouring node indices
+                rNeighbourIndices.push_back(*iter);
             }
         }
     }
 
-    return neighbouring_node_indices;
+    // The candidate neighbours are not necessarily sorted
+    std::sort(rNeighbourIndices.begin(), rNeighbourIndices.end());
+    rNeighbourIndices.erase(std::unique(rNeighbourIndices.begin(), rNeighbourIndices.end()), rNeighbourIndices.end());
 }
 
 template<unsigned DIM>
 std::set<unsigned> NodeBasedCellPopulation<DIM>::GetNeighbouringNodeIndices(unsigned index)
 {
-    std::set<unsigned> neighbouring_node_indices;
+    std::vector<unsigned> neighbouring_node_indices;
+    this->FillNeighbouringNodeIndices(index, neighbouring_node_indices);
+
+    return std::set<unsigned>(neighbouring_node_indices.begin(), neighbouring_node_indices.end());
+}
+
+template<unsigned DIM>
+void NodeBasedCellPopulation<DIM>::FillNeighbouringNodeIndices(unsigned index, std::vector<unsigned>& rNeighbourIndices)
+{
+    rNeighbourIndices.clear();
 
     // Get location and radius of node
     Node<DIM>* p_node_i = this->GetNode(index);
@@ -482,13 +552,15 @@ std::set<unsigned> NodeBasedCellPopulation<DIM>::GetNeighbouringNodeIndices(unsi
             }
             if (distance_between_nodes <= max_interaction_distance)// + DBL_EPSILSON) //Assumes that max_interaction_distance is of order 1
             {
-                // ...then add this node index to the set of neighbouring node indices
-                neighbouring_node_indices.insert((*iter));
+                // ...then add this node index to the neighbouring node indices
+                rNeighbourIndices.push_back(*iter);
             }
         }
     }
 
-    return neighbouring_node_indices;
+    // The candidate neighbours are not necessarily sorted
+    std::sort(rNeighbourIndices.begin(), rNeighbourIndices.end());
+    rNeighbourIndices.erase(std::unique(rNeighbourIndices.begin(), rNeighbourIndices.end()), rNeighbourIndices.end());
 }
 
 template<unsigned DIM>
@@ -651,6 +723,7 @@ void NodeBasedCellPopulation<DIM>::WriteVtkResultsToFile(const std::string& rDir
     {
         auto num_cell_data_items = this->Begin()->GetCellData()->GetNumItems();
         std::vector<std::string> cell_data_names = this->Begin()->GetCellData()->GetKeys();
+        std::vector<unsigned> cell_data_indices = CellData::GetItemIndices(cell_data_names);
         std::vector<std::vector<double>> cell_data(num_cell_data_items, std::vector<double>(num_nodes));
 
         std::vector<double> rank(num_nodes);
@@ -662,7 +735,7 @@ void NodeBasedCellPopulation<DIM>::WriteVtkResultsToFile(const std::string& rDir
 
             for (unsigned cell_data_idx = 0; cell_data_idx < num_cell_data_items; ++cell_data_idx)
             {
-                cell_data[cell_data_idx][node_idx] = cell_iter->GetCellData()->GetItem(cell_data_names[cell_data_idx]);
+                cell_data[cell_data_idx][node_idx] = cell_iter->GetCellData()->GetItem(cell_data_indices[cell_data_idx]);
             }
 
             rank[node_idx] = (PetscTools::GetMyRank());
@@ -112,6 +112,12 @@ private:
     /** The frequency at which the mesh is rebalanced */
     unsigned mLoadBalanceFrequency;
 
+    /**
+     * The frequency, in time steps, at which nodes and cells are reordered along a
+     * space-filling curve to restore memory locality. Zero (the default) means never.
+     */
+    unsigned mSpatialSortFrequency;
+
     /** Needed for serialization. */
     friend class boost::serialization::access;
     /**
@@ -407,6 +413,29 @@ public:
      */
     void SetLoadBalanceFrequency(unsigned loadBalanceFrequency);
 
+    /**
+     * Set the frequency, in number of time steps, with which nodes and cells should be
+     * reordered along a space-filling curve in Update(). Zero switches the reordering off.
+     *
+     * @param spatialSortFrequency the frequency for spatial sorting.
+     */
+    void SetSpatialSortFrequency(unsigned spatialSortFrequency);
+
+    /**
+     * @return #mSpatialSortFrequency.
+     */
+    unsigned GetSpatialSortFrequency() const;
+
+    /**
+     * Reorder the nodes of the mesh along a space-filling curve (see
+     * NodesOnlyMesh::ReorderNodesAlongSpaceFillingCurve()) and then reorder the
+     * cell list to match, so that iterating over cells visits them in spatial order.
+     *
+     * Global node indices are unchanged, so the maps between cells and location
+     * indices (and hence CellIds in any output) are unaffected.
+     */
+    void SortNodesAndCellsAlongSpaceFillingCurve();
+
     /**
      * Overridden GetWidth() method.
      *
@@ -438,6 +467,18 @@ public:
      */
     std::set<unsigned> GetNodesWithinNeighbourhoodRadius(unsigned index, double neighbourhoodRadius);
 
+    /**
+     * Method to fill a vector with the nodes within a given radius of a node, in increasing
+     * order. This gives the same indices as GetNodesWithinNeighbourhoodRadius() without
+     * constructing a set; see FillNeighbouringNodeIndices().
+     *
+     * @param index the node index
+     * @param neighbourhoodRadius the radius to find neighbours in.
+     * Note must be less than the MaximumInteractionDistance in the NodesOnlyMesh
+     * @param rNeighbourIndices vector to be filled with the neighbouring node indices
+     */
+    void FillNodesWithinNeighbourhoodRadius(unsigned index, double neighbourhoodRadius, std::vector<unsigned>& rNeighbourIndices);
+
     /**
      * Overridden GetNeighbouringNodeIndices() method.
      *
@@ -448,6 +489,14 @@ public:
      */
     std::set<unsigned> GetNeighbouringNodeIndices(unsigned index);
 
+    /**
+     * Overridden FillNeighbouringNodeIndices() method.
+     *
+     * @param index the node index
+     * @param rNeighbourIndices vector to be filled with the neighbouring node indices
+     */
+    void FillNeighbouringNodeIndices(unsigned index, std::vector<unsigned>& rNeighbourIndices);
+
     /**
      * Overridden AddCell() method.
      *
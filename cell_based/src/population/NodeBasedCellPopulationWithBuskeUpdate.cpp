@@ -70,6 +70,8 @@ void NodeBasedCellPopulationWithBuskeUpdate<DIM>::UpdateNodeLocations(double dt)
     // Then an rGetForceVector for RHS
     Vec& r_vector = solver.rGetForceVector();
 
+    std::vector<unsigned> neighbouring_node_indices;
+
     // Iterate over all nodes associated with real cells to construct the matrix A.
     for (typename AbstractCellPopulation<DIM>::Iterator cell_iter = this->Begin();
          cell_iter != this->End();
@@ -94,10 +96,10 @@ void NodeBasedCellPopulationWithBuskeUpdate<DIM>::UpdateNodeLocations(double dt)
 
         // loop over neighbours to add contribution
 
-        // Get the set of node indices corresponding to this cell's neighbours
-        std::set<unsigned> neighbouring_node_indices = this->GetNeighbouringNodeIndices(global_node_index);
+        // Get the node indices corresponding to this cell's neighbours
+        this->FillNeighbouringNodeIndices(global_node_index, neighbouring_node_indices);
 
-        for (std::set<unsigned>::iterator iter = neighbouring_node_indices.begin();
+        for (std::vector<unsigned>::iterator iter = neighbouring_node_indices.begin();
              iter != neighbouring_node_indices.end();
              ++iter)
         {
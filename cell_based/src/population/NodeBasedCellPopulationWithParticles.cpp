@@ -237,6 +237,7 @@ void NodeBasedCellPopulationWithParticles<DIM>::WriteVtkResultsToFile(const std:
         num_cell_data_items = this->Begin()->GetCellData()->GetNumItems();
         cell_data_names = this->Begin()->GetCellData()->GetKeys();
     }
+    std::vector<unsigned> cell_data_indices = CellData::GetItemIndices(cell_data_names);
 
     std::vector<std::vector<double> > cell_data;
     for (unsigned var=0; var<num_cell_data_items; var++)
@@ -291,7 +292,7 @@ void NodeBasedCellPopulationWithParticles<DIM>::WriteVtkResultsToFile(const std:
 
         for (unsigned var=0; var<num_cell_data_items; var++)
         {
-            cell_data[var][node_index] = cell_iter->GetCellData()->GetItem(cell_data_names[var]);
+            cell_data[var][node_index] = cell_iter->GetCellData()->GetItem(cell_data_indices[var]);
         }
 
         rank[node_index] = (PetscTools::GetMyRank());
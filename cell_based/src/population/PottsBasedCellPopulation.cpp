@@ -81,7 +81,9 @@ PottsBasedCellPopulation<DIM>::PottsBasedCellPopulation(PottsMesh<DIM>& rMesh,
       mpElementTessellation(nullptr),
       mpMutableMesh(nullptr),
       mTemperature(0.1),
-      mNumSweepsPerTimestep(1)
+      mNumSweepsPerTimestep(1),
+      mElementGeometryCacheIsCurrent(false),
+      mValidateElementGeometryCache(false)
 {
     mpPottsMesh = static_cast<PottsMesh<DIM>* >(&(this->mrMesh));
     // Check each element has only one cell associated with it
@@ -97,7 +99,9 @@ PottsBasedCellPopulation<DIM>::PottsBasedCellPopulation(PottsMesh<DIM>& rMesh)
       mpElementTessellation(nullptr),
       mpMutableMesh(nullptr),
       mTemperature(0.1),
-      mNumSweepsPerTimestep(1)
+      mNumSweepsPerTimestep(1),
+      mElementGeometryCacheIsCurrent(false),
+      mValidateElementGeometryCache(false)
 {
     mpPottsMesh = static_cast<PottsMesh<DIM>* >(&(this->mrMesh));
 }
@@ -176,6 +180,13 @@ std::set<unsigned> PottsBasedCellPopulation<DIM>::GetNeighbouringLocationIndices
     return mpPottsMesh->GetNeighbouringElementIndices(elem_index);
 }
 
+template<unsigned DIM>
+void PottsBasedCellPopulation<DIM>::FillNeighbouringLocationIndices(CellPtr pCell, std::vector<unsigned>& rNeighbourIndices)
+{
+    unsigned elem_index = this->GetLocationIndexUsingCell(pCell);
+    mpPottsMesh->GetNeighbouringElementIndices(elem_index, rNeighbourIndices);
+}
+
 template<unsigned DIM>
 c_vector<double, DIM> PottsBasedCellPopulation<DIM>::GetLocationOfCellCentre(CellPtr pCell)
 {
@@ -260,6 +271,9 @@ void PottsBasedCellPopulation<DIM>::UpdateCellLocations(double dt)
         p_gen->Shuffle(this->mUpdateRuleCollection);
     }
 
+    // Element volumes and surface areas are tracked incrementally during the sweeps
+    InitialiseElementGeometryCache();
+
     for (unsigned i=0; i<num_nodes*mNumSweepsPerTimestep; i++)
     {
         unsigned node_index;
@@ -280,28 +294,21 @@ void PottsBasedCellPopulation<DIM>::UpdateCellLocations(double dt)
         assert(p_node->GetNumContainingElements() <= 1);
 
         // Find a random available neighbouring node to overwrite current site
-        std::set<unsigned> neighbouring_node_indices = mpPottsMesh->GetMooreNeighbouringNodeIndices(node_index);
-        unsigned neighbour_location_index;
+        unsigned num_neighbours = mpPottsMesh->GetNumMooreNeighbours(node_index);
 
-        if (!neighbouring_node_indices.empty())
+        if (num_neighbours > 0)
         {
-            unsigned num_neighbours = neighbouring_node_indices.size();
             unsigned chosen_neighbour = p_gen->randMod(num_neighbours);
+            unsigned neighbour_location_index = mpPottsMesh->GetMooreNeighbour(node_index, chosen_neighbour);
 
-            std::set<unsigned>::iterator neighbour_iter = neighbouring_node_indices.begin();
-            for (unsigned j=0; j<chosen_neighbour; j++)
-            {
-                neighbour_iter++;
-            }
-
-            neighbour_location_index = *neighbour_iter;
+            // Each node is in at most one element; UNSIGNED_UNSET denotes the medium
+            const std::set<unsigned>& r_containing_elements = p_node->rGetContainingElementIndices();
+            const std::set<unsigned>& r_neighbour_containing_elements = GetNode(neighbour_location_index)->rGetContainingElementIndices();
+            unsigned containing_element = r_containing_elements.empty() ? UNSIGNED_UNSET : *r_containing_elements.begin();
+            unsigned neighbour_containing_element = r_neighbour_containing_elements.empty() ? UNSIGNED_UNSET : *r_neighbour_containing_elements.begin();
 
-            std::set<unsigned> containing_elements = p_node->rGetContainingElementIndices();
-            std::set<unsigned> neighbour_containing_elements = GetNode(neighbour_location_index)->rGetContainingElementIndices();
             // Only calculate Hamiltonian and update elements if the nodes are from different elements, or one is from the medium
-            if ((!containing_elements.empty() && neighbour_containing_elements.empty())
-                || (containing_elements.empty() && !neighbour_containing_elements.empty())
-                || (!containing_elements.empty() && !neighbour_containing_elements.empty() && *containing_elements.begin() != *neighbour_containing_elements.begin()))
+            if (containing_element != neighbour_containing_element)
             {
                 double delta_H = 0.0; // This is H_1-H_0.
 
@@ -323,27 +330,150 @@ void PottsBasedCellPopulation<DIM>::UpdateCellLocations(double dt)
                 {
                     // Do swap
 
-                    // Remove the current node from any elements containing it (there should be at most one such element)
-                    for (std::set<unsigned>::iterator iter = containing_elements.begin();
-                         iter != containing_elements.end();
-                         ++iter)
+                    // Remove the current node from the element containing it, if any
+                    if (containing_element != UNSIGNED_UNSET)
                     {
-                        GetElement(*iter)->DeleteNode(GetElement(*iter)->GetNodeLocalIndex(node_index));
+                        GetElement(containing_element)->DeleteNode(GetElement(containing_element)->GetNodeLocalIndex(node_index));
 
                         ///\todo If this causes the element to have no nodes then flag the element and cell to be deleted
                     }
 
-                    // Next add the current node to any elements containing the neighbouring node (there should be at most one such element)
-                    for (std::set<unsigned>::iterator iter = neighbour_containing_elements.begin();
-                         iter != neighbour_containing_elements.end();
-                         ++iter)
+                    // Next add the current node to the element containing the neighbouring node, if any
+                    if (neighbour_containing_element != UNSIGNED_UNSET)
                     {
-                        GetElement(*iter)->AddNode(this->mrMesh.GetNode(node_index));
+                        GetElement(neighbour_containing_element)->AddNode(this->mrMesh.GetNode(node_index));
                     }
+
+                    UpdateElementGeometryCache(node_index, containing_element, neighbour_containing_element);
                 }
             }
         }
     }
+
+    // Elements may be changed by other means (e.g. division) before the next sweep
+    mElementGeometryCacheIsCurrent = false;
+}
+
+template<unsigned DIM>
+void PottsBasedCellPopulation<DIM>::InitialiseElementGeometryCache()
+{
+    unsigned num_elements = mpPottsMesh->GetNumAllElements();
+    mElementVolumes.assign(num_elements, 0.0);
+    mElementSurfaceAreas.assign(num_elements, 0.0);
+
+    for (typename PottsMesh<DIM>::PottsElementIterator elem_iter = mpPottsMesh->GetElementIteratorBegin();
+         elem_iter != mpPottsMesh->GetElementIteratorEnd();
+         ++elem_iter)
+    {
+        unsigned elem_index = elem_iter->GetIndex();
+        mElementVolumes[elem_index] = mpPottsMesh->GetVolumeOfElement(elem_index);
+        if (DIM > 1)
+        {
+            mElementSurfaceAreas[elem_index] = mpPottsMesh->GetSurfaceAreaOfElement(elem_index);
+        }
+    }
+
+    mElementGeometryCacheIsCurrent = true;
+}
+
+template<unsigned DIM>
+void PottsBasedCellPopulation<DIM>::UpdateElementGeometryCache(unsigned nodeIndex, unsigned oldElementIndex, unsigned newElementIndex)
+{
+    assert(mElementGeometryCacheIsCurrent);
+
+    // Count the Von Neumann neighbours of the node lying in the old and new elements
+    unsigned num_neighbours_in_old_element = 0;
+    unsigned num_neighbours_in_new_element = 0;
+    unsigned num_neighbours = mpPottsMesh->GetNumVonNeumannNeighbours(nodeIndex);
+    for (unsigned neighbour=0; neighbour<num_neighbours; neighbour++)
+    {
+        const std::set<unsigned>& r_elements = this->GetNode(mpPottsMesh->GetVonNeumannNeighbour(nodeIndex, neighbour))->rGetContainingElementIndices();
+        if (!r_elements.empty())
+        {
+            if (*r_elements.begin() == oldElementIndex)
+            {
+                num_neighbours_in_old_element++;
+            }
+            else if (*r_elements.begin() == newElementIndex)
+            {
+                num_neighbours_in_new_element++;
+            }
+        }
+    }
+
+    /*
+     * Each node contributes one unit of surface area for each of its 2*DIM faces that is
+     * not shared with a node of the same element. Removing the node from an element
+     * therefore removes its own (2*DIM - n) exposed faces and exposes the n faces of its
+     * neighbours in that element, and conversely when adding it.
+     */
+    if (oldElementIndex != UNSIGNED_UNSET)
+    {
+        mElementVolumes[oldElementIndex] -= 1.0;
+        mElementSurfaceAreas[oldElementIndex] += 2.0*num_neighbours_in_old_element - 2.0*DIM;
+    }
+    if (newElementIndex != UNSIGNED_UNSET)
+    {
+        mElementVolumes[newElementIndex] += 1.0;
+        mElementSurfaceAreas[newElementIndex] += 2.0*DIM - 2.0*num_neighbours_in_new_element;
+    }
+
+    if (mValidateElementGeometryCache)
+    {
+        ValidateElementGeometryCache();
+    }
+}
+
+template<unsigned DIM>
+void PottsBasedCellPopulation<DIM>::ValidateElementGeometryCache()
+{
+    for (typename PottsMesh<DIM>::PottsElementIterator elem_iter = mpPottsMesh->GetElementIteratorBegin();
+         elem_iter != mpPottsMesh->GetElementIteratorEnd();
+         ++elem_iter)
+    {
+        unsigned elem_index = elem_iter->GetIndex();
+        double volume = mpPottsMesh->GetVolumeOfElement(elem_index);
+        if (fabs(volume - mElementVolumes[elem_index]) > 1e-10)
+        {
+            EXCEPTION("Cached volume " << mElementVolumes[elem_index] << " of element " << elem_index << " does not match the mesh volume " << volume);
+        }
+        if (DIM > 1)
+        {
+            double surface_area = mpPottsMesh->GetSurfaceAreaOfElement(elem_index);
+            if (fabs(surface_area - mElementSurfaceAreas[elem_index]) > 1e-10)
+            {
+                EXCEPTION("Cached surface area " << mElementSurfaceAreas[elem_index] << " of element " << elem_index << " does not match the mesh surface area " << surface_area);
+            }
+        }
+    }
+}
+
+template<unsigned DIM>
+double PottsBasedCellPopulation<DIM>::GetVolumeOfElement(unsigned elementIndex)
+{
+    if (mElementGeometryCacheIsCurrent)
+    {
+        assert(elementIndex < mElementVolumes.size());
+        return mElementVolumes[elementIndex];
+    }
+    return mpPottsMesh->GetVolumeOfElement(elementIndex);
+}
+
+template<unsigned DIM>
+double PottsBasedCellPopulation<DIM>::GetSurfaceAreaOfElement(unsigned elementIndex)
+{
+    if (mElementGeometryCacheIsCurrent && DIM > 1)
+    {
+        assert(elementIndex < mElementSurfaceAreas.size());
+        return mElementSurfaceAreas[elementIndex];
+    }
+    return mpPottsMesh->GetSurfaceAreaOfElement(elementIndex);
+}
+
+template<unsigned DIM>
+void PottsBasedCellPopulation<DIM>::SetValidateElementGeometryCache(bool validateElementGeometryCache)
+{
+    mValidateElementGeometryCache = validateElementGeometryCache;
 }
 
 template<unsigned DIM>
@@ -562,6 +692,7 @@ void PottsBasedCellPopulation<DIM>::WriteVtkResultsToFile(const std::string& rDi
     // When outputting any CellData, we assume that the first cell is representative of all cells
     unsigned num_cell_data_items = this->Begin()->GetCellData()->GetNumItems();
     std::vector<std::string> cell_data_names = this->Begin()->GetCellData()->GetKeys();
+    std::vector<unsigned> cell_data_indices = CellData::GetItemIndices(cell_data_names);
 
     std::vector<std::vector<double> > cell_data;
     for (unsigned var=0; var<num_cell_data_items; var++)
@@ -595,7 +726,7 @@ void PottsBasedCellPopulation<DIM>::WriteVtkResultsToFile(const std::string& rDi
 
             for (unsigned var=0; var<num_cell_data_items; var++)
             {
-                cell_data[var][node_index] = p_cell->GetCellData()->GetItem(cell_data_names[var]);
+                cell_data[var][node_index] = p_cell->GetCellData()->GetItem(cell_data_indices[var]);
             }
         }
     }
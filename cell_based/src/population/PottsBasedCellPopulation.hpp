@@ -91,6 +91,29 @@ private:
      */
     unsigned mNumSweepsPerTimestep;
 
+    /**
+     * The volume of each element, indexed by element index. This cache is built at the
+     * start of UpdateCellLocations() and updated incrementally after each accepted spin
+     * flip, so that update rules can read element volumes in O(1).
+     */
+    std::vector<double> mElementVolumes;
+
+    /**
+     * The surface area (perimeter in 2D) of each element, maintained alongside
+     * mElementVolumes. Only used in 2D and 3D.
+     */
+    std::vector<double> mElementSurfaceAreas;
+
+    /** Whether mElementVolumes and mElementSurfaceAreas are currently valid. */
+    bool mElementGeometryCacheIsCurrent;
+
+    /**
+     * Whether to cross-check the cached element geometry against a full recomputation
+     * from the mesh after every accepted spin flip. This is expensive and is intended
+     * for testing. Defaults to false.
+     */
+    bool mValidateElementGeometryCache;
+
     friend class boost::serialization::access;
     /**
      * Serialize the object and its member variables.
@@ -136,6 +159,28 @@ private:
      */
     virtual void WriteVtkResultsToFile(const std::string& rDirectory);
 
+    /**
+     * Compute the volume and surface area of every element from the mesh and store
+     * them in mElementVolumes and mElementSurfaceAreas.
+     */
+    void InitialiseElementGeometryCache();
+
+    /**
+     * Update the cached element geometry after a node has moved from one element to
+     * another. Only the Von Neumann neighbourhood of the node is examined.
+     *
+     * @param nodeIndex the global index of the node that has moved
+     * @param oldElementIndex the element that contained the node, or UNSIGNED_UNSET for the medium
+     * @param newElementIndex the element that now contains the node, or UNSIGNED_UNSET for the medium
+     */
+    void UpdateElementGeometryCache(unsigned nodeIndex, unsigned oldElementIndex, unsigned newElementIndex);
+
+    /**
+     * Check that the cached element geometry agrees with a full recomputation from
+     * the mesh, throwing an exception if not.
+     */
+    void ValidateElementGeometryCache();
+
 public:
 
     /**
@@ -228,6 +273,14 @@ public:
      */
     std::set<unsigned> GetNeighbouringLocationIndices(CellPtr pCell);
 
+    /**
+     * Overridden FillNeighbouringLocationIndices() method.
+     *
+     * @param pCell a cell
+     * @param rNeighbourIndices vector to be filled with the neighbouring location indices
+     */
+    void FillNeighbouringLocationIndices(CellPtr pCell, std::vector<unsigned>& rNeighbourIndices);
+
     /**
      * Overridden GetLocationOfCellCentre() method.
      * Find where a given cell is in space.
@@ -386,6 +439,33 @@ public:
      */
     unsigned GetNumSweepsPerTimestep();
 
+    /**
+     * Get the volume of an element. During UpdateCellLocations() this is read from a
+     * cache that is updated incrementally; otherwise it is computed by the mesh.
+     *
+     * @param elementIndex the index of the element
+     * @return the volume of the element
+     */
+    double GetVolumeOfElement(unsigned elementIndex);
+
+    /**
+     * Get the surface area (perimeter in 2D) of an element. During UpdateCellLocations()
+     * this is read from a cache that is updated incrementally; otherwise it is computed
+     * by the mesh.
+     *
+     * @param elementIndex the index of the element
+     * @return the surface area of the element
+     */
+    double GetSurfaceAreaOfElement(unsigned elementIndex);
+
+    /**
+     * Set mValidateElementGeometryCache.
+     *
+     * @param validateElementGeometryCache whether to check the cached element geometry
+     *     against a full recomputation after every accepted spin flip
+     */
+    void SetValidateElementGeometryCache(bool validateElementGeometryCache);
+
     /**
      * Create a Element tessellation of the mesh for use in visualising the mesh.
      */
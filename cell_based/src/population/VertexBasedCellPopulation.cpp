@@ -174,6 +174,13 @@ std::set<unsigned> VertexBasedCellPopulation<DIM>::GetNeighbouringLocationIndice
     return this->rGetMesh().GetNeighbouringElementIndices(elem_index);
 }
 
+template<unsigned DIM>
+void VertexBasedCellPopulation<DIM>::FillNeighbouringLocationIndices(CellPtr pCell, std::vector<unsigned>& rNeighbourIndices)
+{
+    unsigned elem_index = this->GetLocationIndexUsingCell(pCell);
+    this->rGetMesh().GetNeighbouringElementIndices(elem_index, rNeighbourIndices);
+}
+
 template<unsigned DIM>
 unsigned VertexBasedCellPopulation<DIM>::AddNode(Node<DIM>* pNewNode)
 {
@@ -427,6 +434,7 @@ void VertexBasedCellPopulation<DIM>::WriteVtkResultsToFile(const std::string& rD
     // When outputting any CellData, we assume that the first cell is representative of all cells
     unsigned num_cell_data_items = this->Begin()->GetCellData()->GetNumItems();
     std::vector<std::string> cell_data_names = this->Begin()->GetCellData()->GetKeys();
+    std::vector<unsigned> cell_data_indices = CellData::GetItemIndices(cell_data_names);
 
     std::vector<std::vector<double> > cell_data;
     for (unsigned var=0; var<num_cell_data_items; var++)
@@ -449,7 +457,7 @@ void VertexBasedCellPopulation<DIM>::WriteVtkResultsToFile(const std::string& rD
 
         for (unsigned var=0; var<num_cell_data_items; var++)
         {
-            cell_data[var][elem_index] = p_cell->GetCellData()->GetItem(cell_data_names[var]);
+            cell_data[var][elem_index] = p_cell->GetCellData()->GetItem(cell_data_indices[var]);
         }
     }
     for (unsigned var=0; var<num_cell_data_items; var++)
@@ -545,6 +553,12 @@ std::set<unsigned> VertexBasedCellPopulation<DIM>::GetNeighbouringNodeIndices(un
     return mpMutableVertexMesh->GetNeighbouringNodeIndices(index);
 }
 
+template<unsigned DIM>
+void VertexBasedCellPopulation<DIM>::FillNeighbouringNodeIndices(unsigned index, std::vector<unsigned>& rNeighbourIndices)
+{
+    mpMutableVertexMesh->GetNeighbouringNodeIndices(index, rNeighbourIndices);
+}
+
 template<unsigned DIM>
 boost::shared_ptr<AbstractVertexBasedDivisionRule<DIM> > VertexBasedCellPopulation<DIM>::GetVertexBasedDivisionRule()
 {
@@ -238,6 +238,14 @@ public:
      */
     std::set<unsigned> GetNeighbouringLocationIndices(CellPtr pCell);
 
+    /**
+     * Overridden FillNeighbouringLocationIndices() method.
+     *
+     * @param pCell a cell
+     * @param rNeighbourIndices vector to be filled with the neighbouring location indices
+     */
+    void FillNeighbouringLocationIndices(CellPtr pCell, std::vector<unsigned>& rNeighbourIndices);
+
     /**
      * Overridden AddNode() method.
      *
@@ -441,6 +449,14 @@ public:
      */
     std::set<unsigned> GetNeighbouringNodeIndices(unsigned index);
 
+    /**
+     * Overridden FillNeighbouringNodeIndices() method.
+     *
+     * @param index the node index
+     * @param rNeighbourIndices vector to be filled with the neighbouring node indices
+     */
+    void FillNeighbouringNodeIndices(unsigned index, std::vector<unsigned>& rNeighbourIndices);
+
     /**
      * Overridden GetTetrahedralMeshForPdeModifier() method.
      *
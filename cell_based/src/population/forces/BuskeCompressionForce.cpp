@@ -64,6 +64,7 @@ void BuskeCompressionForce<DIM>::AddForceContribution(AbstractCellPopulation<DIM
     NodeBasedCellPopulation<DIM>* p_static_cast_cell_population = static_cast<NodeBasedCellPopulation<DIM>*>(&rCellPopulation);
 
     c_vector<double, DIM> unit_vector;
+    std::vector<unsigned> neighbouring_node_indices;
 
     // Loop over cells in the population
     for (typename AbstractCellPopulation<DIM>::Iterator cell_iter = rCellPopulation.Begin();
@@ -84,11 +85,11 @@ void BuskeCompressionForce<DIM>::AddForceContribution(AbstractCellPopulation<DIM
         double delta_V_c = 0.0;
         c_vector<double, DIM> dVAdd_vector = zero_vector<double>(DIM);
 
-        // Get the set of node indices corresponding to this cell's neighbours
-        std::set<unsigned> neighbouring_node_indices = p_static_cast_cell_population->GetNeighbouringNodeIndices(node_index);
+        // Get the node indices corresponding to this cell's neighbours
+        p_static_cast_cell_population->FillNeighbouringNodeIndices(node_index, neighbouring_node_indices);
 
-        // Loop over this set
-        for (std::set<unsigned>::iterator iter = neighbouring_node_indices.begin();
+        // Loop over these neighbours
+        for (std::vector<unsigned>::iterator iter = neighbouring_node_indices.begin();
              iter != neighbouring_node_indices.end();
              ++iter)
         {
@@ -77,11 +77,20 @@ c_vector<double, SPACE_DIM> GeneralisedLinearSpringForce<ELEMENT_DIM,SPACE_DIM>:
     const c_vector<double, SPACE_DIM>& r_node_a_location = p_node_a->rGetLocation();
     const c_vector<double, SPACE_DIM>& r_node_b_location = p_node_b->rGetLocation();
 
+    /*
+     * This method is called once for every pair of interacting nodes at every time
+     * step, so work out the type of cell population just once here rather than
+     * wherever it is needed below.
+     */
+    bool is_node_based = bool(dynamic_cast<NodeBasedCellPopulation<SPACE_DIM>*>(&rCellPopulation));
+    MeshBasedCellPopulation<ELEMENT_DIM,SPACE_DIM>* p_mesh_based_population = is_node_based ? nullptr : dynamic_cast<MeshBasedCellPopulation<ELEMENT_DIM,SPACE_DIM>*>(&rCellPopulation);
+    bool is_mesh_based = (p_mesh_based_population != nullptr);
+
     // Get the node radii for a NodeBasedCellPopulation
     double node_a_radius = 0.0;
     double node_b_radius = 0.0;
 
-    if (bool(dynamic_cast<NodeBasedCellPopulation<SPACE_DIM>*>(&rCellPopulation)))
+    if (is_node_based)
     {
         node_a_radius = p_node_a->GetRadius();
         node_b_radius = p_node_b->GetRadius();
@@ -122,11 +131,11 @@ c_vector<double, SPACE_DIM> GeneralisedLinearSpringForce<ELEMENT_DIM,SPACE_DIM>:
      */
     double rest_length_final = 1.0;
 
-    if (bool(dynamic_cast<MeshBasedCellPopulation<ELEMENT_DIM,SPACE_DIM>*>(&rCellPopulation)))
+    if (is_mesh_based)
     {
-        rest_length_final = static_cast<MeshBasedCellPopulation<ELEMENT_DIM,SPACE_DIM>*>(&rCellPopulation)->GetRestLength(nodeAGlobalIndex, nodeBGlobalIndex);
+        rest_length_final = p_mesh_based_population->GetRestLength(nodeAGlobalIndex, nodeBGlobalIndex);
     }
-    else if (bool(dynamic_cast<NodeBasedCellPopulation<SPACE_DIM>*>(&rCellPopulation)))
+    else if (is_node_based)
     {
         assert(node_a_radius > 0 && node_b_radius > 0);
         rest_length_final = node_a_radius+node_b_radius;
@@ -172,7 +181,7 @@ c_vector<double, SPACE_DIM> GeneralisedLinearSpringForce<ELEMENT_DIM,SPACE_DIM>:
     double a_rest_length = rest_length*0.5;
     double b_rest_length = a_rest_length;
 
-    if (bool(dynamic_cast<NodeBasedCellPopulation<SPACE_DIM>*>(&rCellPopulation)))
+    if (is_node_based)
     {
         assert(node_a_radius > 0 && node_b_radius > 0);
         a_rest_length = (node_a_radius/(node_a_radius+node_b_radius))*rest_length;
@@ -204,7 +213,7 @@ c_vector<double, SPACE_DIM> GeneralisedLinearSpringForce<ELEMENT_DIM,SPACE_DIM>:
     double multiplication_factor = VariableSpringConstantMultiplicationFactor(nodeAGlobalIndex, nodeBGlobalIndex, rCellPopulation, is_closer_than_rest_length);
     double spring_stiffness = mMeinekeSpringStiffness;
 
-    if (bool(dynamic_cast<MeshBasedCellPopulation<ELEMENT_DIM,SPACE_DIM>*>(&rCellPopulation)))
+    if (is_mesh_based)
     {
         return multiplication_factor * spring_stiffness * unit_difference * overlap;
     }
@@ -56,8 +56,8 @@ double VolumeConstraintPottsUpdateRule<DIM>::EvaluateHamiltonianContribution(uns
 {
     double delta_H = 0.0;
 
-    std::set<unsigned> containing_elements = rCellPopulation.GetNode(currentNodeIndex)->rGetContainingElementIndices();
-    std::set<unsigned> new_location_containing_elements = rCellPopulation.GetNode(targetNodeIndex)->rGetContainingElementIndices();
+    const std::set<unsigned>& containing_elements = rCellPopulation.GetNode(currentNodeIndex)->rGetContainingElementIndices();
+    const std::set<unsigned>& new_location_containing_elements = rCellPopulation.GetNode(targetNodeIndex)->rGetContainingElementIndices();
 
     bool current_node_contained = !containing_elements.empty();
     bool target_node_contained = !new_location_containing_elements.empty();
@@ -81,7 +81,7 @@ double VolumeConstraintPottsUpdateRule<DIM>::EvaluateHamiltonianContribution(uns
     if (current_node_contained) // current node is in an element
     {
         unsigned current_element = (*containing_elements.begin());
-        double current_volume = rCellPopulation.rGetMesh().GetVolumeOfElement(current_element);
+        double current_volume = rCellPopulation.GetVolumeOfElement(current_element);
         double current_volume_difference = current_volume - mMatureCellTargetVolume;
 
         delta_H += mDeformationEnergyParameter*((current_volume_difference + 1.0)*(current_volume_difference + 1.0) - current_volume_difference*current_volume_difference);
@@ -89,7 +89,7 @@ double VolumeConstraintPottsUpdateRule<DIM>::EvaluateHamiltonianContribution(uns
     if (target_node_contained) // target node is in an element
     {
         unsigned target_element = (*new_location_containing_elements.begin());
-        double target_volume = rCellPopulation.rGetMesh().GetVolumeOfElement(target_element);
+        double target_volume = rCellPopulation.GetVolumeOfElement(target_element);
         double target_volume_difference = target_volume - mMatureCellTargetVolume;
 
         delta_H += mDeformationEnergyParameter*((target_volume_difference - 1.0)*(target_volume_difference - 1.0) - target_volume_difference*target_volume_difference);
@@ -40,6 +40,7 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "CellBasedEventHandler.hpp"
 #include "ForwardEulerNumericalMethod.hpp"
 #include "StepSizeException.hpp"
+#include "VertexMesh.hpp"
 
 template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
 OffLatticeSimulation<ELEMENT_DIM,SPACE_DIM>::OffLatticeSimulation(AbstractCellPopulation<ELEMENT_DIM,SPACE_DIM>& rCellPopulation,
@@ -163,6 +164,7 @@ void OffLatticeSimulation<ELEMENT_DIM,SPACE_DIM>::RevertToOldLocations(std::map<
     {
         (node_iter)->rGetModifiableLocation() = oldNodeLoctions[&(*node_iter)];
     }
+    InvalidateElementGeometryCache();
 }
 
 template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
@@ -175,6 +177,10 @@ void OffLatticeSimulation<ELEMENT_DIM,SPACE_DIM>::ApplyBoundaries(std::map<Node<
     {
         (*bcs_iter)->ImposeBoundaryCondition(oldNodeLoctions);
     }
+    if (!mBoundaryConditions.empty())
+    {
+        InvalidateElementGeometryCache();
+    }
 
     // Verify that each boundary condition is now satisfied
     for (typename std::vector<boost::shared_ptr<AbstractCellPopulationBoundaryCondition<ELEMENT_DIM,SPACE_DIM> > >::iterator bcs_iter = mBoundaryConditions.begin();
@@ -188,6 +194,16 @@ void OffLatticeSimulation<ELEMENT_DIM,SPACE_DIM>::ApplyBoundaries(std::map<Node<
     }
 }
 
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+void OffLatticeSimulation<ELEMENT_DIM,SPACE_DIM>::InvalidateElementGeometryCache()
+{
+    VertexMesh<ELEMENT_DIM, SPACE_DIM>* p_vertex_mesh = dynamic_cast<VertexMesh<ELEMENT_DIM, SPACE_DIM>*>(&(this->mrCellPopulation.rGetMesh()));
+    if (p_vertex_mesh)
+    {
+        p_vertex_mesh->InvalidateElementGeometryCache();
+    }
+}
+
 template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
 void OffLatticeSimulation<ELEMENT_DIM,SPACE_DIM>::WriteVisualizerSetupFile()
 {
@@ -213,6 +229,17 @@ void OffLatticeSimulation<ELEMENT_DIM,SPACE_DIM>::SetupSolve()
         node_iter->ClearAppliedForce();
     }
 
+    /*
+     * Forces, modifiers and writers query the same element areas, perimeters and centroids
+     * many times per time step, so cache these in a vertex mesh. Nodes moved by the numerical
+     * method go through SetNode(), which keeps the cache up to date.
+     */
+    VertexMesh<ELEMENT_DIM, SPACE_DIM>* p_vertex_mesh = dynamic_cast<VertexMesh<ELEMENT_DIM, SPACE_DIM>*>(&(this->mrCellPopulation.rGetMesh()));
+    if (p_vertex_mesh)
+    {
+        p_vertex_mesh->SetUseElementGeometryCache(true);
+    }
+
     // Use a forward Euler method by default, unless a numerical method has been specified already
     if (mpNumericalMethod == nullptr)
     {
@@ -126,7 +126,14 @@ protected:
     void ApplyBoundaries(std::map<Node<SPACE_DIM>*, c_vector<double, SPACE_DIM> > oldNodeLoctions);
 
     /**
-     * Overridden SetupSolve() method to clear the forces applied to the nodes.
+     * If the cell population uses a vertex mesh, invalidate its cached element geometry.
+     * Called after boundary conditions or adaptive time stepping have moved nodes directly.
+     */
+    void InvalidateElementGeometryCache();
+
+    /**
+     * Overridden SetupSolve() method to clear the forces applied to the nodes,
+     * and to switch on the element geometry cache of a vertex mesh.
      */
     virtual void SetupSolve();
 
@@ -69,6 +69,10 @@ void DeltaNotchTrackingModifier<DIM>::UpdateCellData(AbstractCellPopulation<DIM,
     // Make sure the cell population is updated
     rCellPopulation.Update();
 
+    unsigned notch_index = CellData::GetItemIndex("notch");
+    unsigned delta_index = CellData::GetItemIndex("delta");
+    unsigned mean_delta_index = CellData::GetItemIndex("mean delta");
+
     // First recover each cell's Notch and Delta concentrations from the ODEs and store in CellData
     for (typename AbstractCellPopulation<DIM>::Iterator cell_iter = rCellPopulation.Begin();
          cell_iter != rCellPopulation.End();
@@ -79,36 +83,37 @@ void DeltaNotchTrackingModifier<DIM>::UpdateCellData(AbstractCellPopulation<DIM,
         double this_notch = p_model->GetNotch();
 
         // Note that the state variables must be in the same order as listed in DeltaNotchOdeSystem
-        cell_iter->GetCellData()->SetItem("notch", this_notch);
-        cell_iter->GetCellData()->SetItem("delta", this_delta);
+        cell_iter->GetCellData()->SetItem(notch_index, this_notch);
+        cell_iter->GetCellData()->SetItem(delta_index, this_delta);
     }
 
     // Next iterate over the population to compute and store each cell's neighbouring Delta concentration in CellData
+    std::vector<unsigned> neighbour_indices;
     for (typename AbstractCellPopulation<DIM>::Iterator cell_iter = rCellPopulation.Begin();
          cell_iter != rCellPopulation.End();
          ++cell_iter)
     {
-        // Get the set of neighbouring location indices
-        std::set<unsigned> neighbour_indices = rCellPopulation.GetNeighbouringLocationIndices(*cell_iter);
+        // Get the neighbouring location indices, reusing the same vector for each cell
+        rCellPopulation.FillNeighbouringLocationIndices(*cell_iter, neighbour_indices);
 
         // Compute this cell's average neighbouring Delta concentration and store in CellData
         if (!neighbour_indices.empty())
         {
             double mean_delta = 0.0;
-            for (std::set<unsigned>::iterator iter = neighbour_indices.begin();
+            for (std::vector<unsigned>::iterator iter = neighbour_indices.begin();
                  iter != neighbour_indices.end();
                  ++iter)
             {
                 CellPtr p_cell = rCellPopulation.GetCellUsingLocationIndex(*iter);
-                double this_delta = p_cell->GetCellData()->GetItem("delta");
+                double this_delta = p_cell->GetCellData()->GetItem(delta_index);
                 mean_delta += this_delta/neighbour_indices.size();
             }
-            cell_iter->GetCellData()->SetItem("mean delta", mean_delta);
+            cell_iter->GetCellData()->SetItem(mean_delta_index, mean_delta);
         }
         else
         {
             // If this cell has no neighbours, such as an isolated cell in a CaBasedCellPopulation, store 0.0 for the cell data
-            cell_iter->GetCellData()->SetItem("mean delta", 0.0);
+            cell_iter->GetCellData()->SetItem(mean_delta_index, 0.0);
         }
     }
 }
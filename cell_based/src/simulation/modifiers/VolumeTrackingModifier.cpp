@@ -83,6 +83,8 @@ void VolumeTrackingModifier<DIM>::UpdateCellData(AbstractCellPopulation<DIM,DIM>
         static_cast<MeshBasedCellPopulation<DIM>*>(&(rCellPopulation))->CreateVoronoiTessellation();
     }
 
+    unsigned volume_index = CellData::GetItemIndex("volume");
+
     // Iterate over cell population
     for (typename AbstractCellPopulation<DIM>::Iterator cell_iter = rCellPopulation.Begin();
          cell_iter != rCellPopulation.End();
@@ -92,7 +94,7 @@ void VolumeTrackingModifier<DIM>::UpdateCellData(AbstractCellPopulation<DIM,DIM>
         double cell_volume = rCellPopulation.GetVolumeOfCell(*cell_iter);
 
         // Store the cell's volume in CellData
-        cell_iter->GetCellData()->SetItem("volume", cell_volume);
+        cell_iter->GetCellData()->SetItem(volume_index, cell_volume);
     }
 }
 
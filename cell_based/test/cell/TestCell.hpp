@@ -63,6 +63,7 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "DifferentiatedCellProliferativeType.hpp"
 #include "ApoptoticCellProperty.hpp"
 #include "CellAncestor.hpp"
+#include "CellBasedEventHandler.hpp"
 
 #include "AbstractCellBasedTestSuite.hpp"
 #include "FakePetscSetup.hpp"
@@ -437,6 +438,37 @@ public:
         TS_ASSERT_EQUALS(p_daughter_cell->ReadyToDivide(), true);
     }
 
+    void TestCellMemoryIsRecycled()
+    {
+        SimulationTime::Instance()->SetEndTimeAndNumberOfTimeSteps(1.0, 1);
+        MAKE_PTR(WildTypeCellMutationState, p_state);
+
+        CellBasedEventHandler::ResetCounters();
+
+        // Each cell allocates itself and its CellData
+        Cell* p_address;
+        {
+            CellPtr p_cell(new Cell(p_state, new UniformG1GenerationalCellCycleModel()));
+            p_address = p_cell.get();
+        }
+        TS_ASSERT_EQUALS(CellBasedEventHandler::GetCounter(CellBasedEventHandler::DEALLOCATIONS), 2u);
+        unsigned long num_heap_allocations = CellBasedEventHandler::GetCounter(CellBasedEventHandler::HEAP_ALLOCATIONS);
+        TS_ASSERT_EQUALS(num_heap_allocations + CellBasedEventHandler::GetCounter(CellBasedEventHandler::RECYCLED_ALLOCATIONS), 2u);
+
+        // A new cell reuses the memory of the destroyed one, without going to the heap
+        {
+            CellPtr p_cell(new Cell(p_state, new UniformG1GenerationalCellCycleModel()));
+            TS_ASSERT_EQUALS(p_cell.get(), p_address);
+            TS_ASSERT_EQUALS(CellBasedEventHandler::GetCounter(CellBasedEventHandler::HEAP_ALLOCATIONS), num_heap_allocations);
+            TS_ASSERT_EQUALS(CellBasedEventHandler::GetCounter(CellBasedEventHandler::RECYCLED_ALLOCATIONS), 4u - num_heap_allocations);
+        }
+        TS_ASSERT_EQUALS(CellBasedEventHandler::GetCounter(CellBasedEventHandler::DEALLOCATIONS), 4u);
+
+        // A cell whose constructor throws still frees its memory
+        TS_ASSERT_THROWS_THIS(CellPtr p_bad_cell(new Cell(p_state, nullptr)), "Cell-cycle model is null");
+        TS_ASSERT_EQUALS(CellBasedEventHandler::GetCounter(CellBasedEventHandler::DEALLOCATIONS), 5u);
+    }
+
     void Test0DBucket()
     {
         double end_time = 61.0;
@@ -100,6 +100,46 @@ public:
         TS_ASSERT_EQUALS(p_daughtercell_data->GetItem("some other thing"), 2.0);
     }
 
+    void TestCellDataItemIndices()
+    {
+        // Item indices are shared between all CellData objects
+        unsigned oxygen_index = CellData::GetItemIndex("oxygen");
+        unsigned glucose_index = CellData::GetItemIndex("glucose");
+        TS_ASSERT_DIFFERS(oxygen_index, glucose_index);
+        TS_ASSERT_EQUALS(CellData::GetItemIndex("oxygen"), oxygen_index);
+        TS_ASSERT_EQUALS(CellData::rGetItemName(glucose_index), "glucose");
+
+        CellData cell_data;
+        TS_ASSERT_EQUALS(cell_data.GetNumItems(), 0u);
+        TS_ASSERT_THROWS_THIS(cell_data.GetItem(oxygen_index), "The item oxygen is not stored");
+        TS_ASSERT_THROWS_THIS(cell_data.GetItem("nothing"), "The item nothing is not stored");
+
+        // Items set by index can be read by name, and vice versa
+        cell_data.SetItem(oxygen_index, 0.5);
+        cell_data.SetItem("glucose", 1.5);
+        TS_ASSERT_EQUALS(cell_data.GetNumItems(), 2u);
+        TS_ASSERT_DELTA(cell_data.GetItem("oxygen"), 0.5, 1e-12);
+        TS_ASSERT_DELTA(cell_data.GetItem(glucose_index), 1.5, 1e-12);
+
+        // Overwriting an item does not change the number of items
+        cell_data.SetItem(oxygen_index, 0.25);
+        TS_ASSERT_EQUALS(cell_data.GetNumItems(), 2u);
+        TS_ASSERT_DELTA(cell_data.GetItem(oxygen_index), 0.25, 1e-12);
+
+        // Keys are returned in alphabetical order, regardless of the order of registration
+        std::vector<std::string> keys = cell_data.GetKeys();
+        TS_ASSERT_EQUALS(keys.size(), 2u);
+        TS_ASSERT_EQUALS(keys[0], "glucose");
+        TS_ASSERT_EQUALS(keys[1], "oxygen");
+
+        // Copies are independent
+        CellData copied_cell_data(cell_data);
+        copied_cell_data.SetItem(oxygen_index, 1.0);
+        TS_ASSERT_DELTA(cell_data.GetItem(oxygen_index), 0.25, 1e-12);
+        TS_ASSERT_DELTA(copied_cell_data.GetItem(oxygen_index), 1.0, 1e-12);
+        TS_ASSERT_DELTA(copied_cell_data.GetItem(glucose_index), 1.5, 1e-12);
+    }
+
     void TestCellVecData()
     {
         SimulationTime* p_simulation_time = SimulationTime::Instance();
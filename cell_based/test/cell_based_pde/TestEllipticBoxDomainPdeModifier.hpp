@@ -114,6 +114,18 @@ public:
         TS_ASSERT_EQUALS(p_pde_modifier->GetOutputGradient(),false); // Defaults to false
         p_pde_modifier->SetOutputGradient(true);
         TS_ASSERT_EQUALS(p_pde_modifier->GetOutputGradient(),true);
+
+        TS_ASSERT_EQUALS(p_pde_modifier->GetTimeStepsPerSolve(), 1u); // Defaults to 1
+        p_pde_modifier->SetTimeStepsPerSolve(3);
+        TS_ASSERT_EQUALS(p_pde_modifier->GetTimeStepsPerSolve(), 3u);
+        TS_ASSERT_THROWS_THIS(p_pde_modifier->SetTimeStepsPerSolve(0),
+                              "The number of time steps per solve must be positive.");
+
+        TS_ASSERT_EQUALS(p_pde_modifier->GetSourceTermChangeTolerance(), DBL_MAX); // Defaults to DBL_MAX
+        p_pde_modifier->SetSourceTermChangeTolerance(0.1);
+        TS_ASSERT_DELTA(p_pde_modifier->GetSourceTermChangeTolerance(), 0.1, 1e-12);
+        TS_ASSERT_THROWS_THIS(p_pde_modifier->SetSourceTermChangeTolerance(-0.1),
+                              "The source term change tolerance must be non-negative.");
     }
 
     void TestArchiveEllipticBoxDomainPdeModifier()
@@ -143,6 +155,10 @@ public:
             Vec vector = PetscTools::CreateVec(data);
             EllipticBoxDomainPdeModifier<2> modifier(p_pde, p_bc, false, p_cuboid, 2.0, vector);
             modifier.SetDependentVariableName("averaged quantity");
+            modifier.SetTimeStepsPerSolve(4);
+            modifier.SetSourceTermChangeTolerance(0.2);
+            MAKE_PTR_ARGS(UniformSourceEllipticPde<2>, p_pde2, (-0.2));
+            modifier.AddPde(p_pde2, p_bc, "second quantity");
 
             // Create an output archive
             std::ofstream ofs(archive_filename.c_str());
@@ -167,6 +183,9 @@ public:
             TS_ASSERT_EQUALS((static_cast<EllipticBoxDomainPdeModifier<2>*>(p_modifier2))->rGetDependentVariableName(), "averaged quantity");
             TS_ASSERT_DELTA((static_cast<EllipticBoxDomainPdeModifier<2>*>(p_modifier2))->GetStepSize(), 2.0, 1e-5);
             TS_ASSERT_EQUALS((static_cast<EllipticBoxDomainPdeModifier<2>*>(p_modifier2))->AreBcsSetOnBoxBoundary(), true);
+            TS_ASSERT_EQUALS((static_cast<EllipticBoxDomainPdeModifier<2>*>(p_modifier2))->GetTimeStepsPerSolve(), 4u);
+            TS_ASSERT_DELTA((static_cast<EllipticBoxDomainPdeModifier<2>*>(p_modifier2))->GetSourceTermChangeTolerance(), 0.2, 1e-12);
+            TS_ASSERT_EQUALS((static_cast<EllipticBoxDomainPdeModifier<2>*>(p_modifier2))->GetNumAdditionalPdes(), 1u);
 
             Vec solution = (static_cast<EllipticBoxDomainPdeModifier<2>*>(p_modifier2))->GetSolution();
             ReplicatableVector solution_repl(solution);
@@ -237,6 +256,180 @@ public:
         TS_ASSERT_DELTA( p_cell_0->GetCellData()->GetItem("variable_grad_y"), -0.0179, 1e-4);
     }
 
+    void TestWarmStartAndTimeStepsPerSolve()
+    {
+        HoneycombMeshGenerator generator(10,10,0);
+        MutableMesh<2,2>* p_mesh = generator.GetMesh();
+
+        std::vector<CellPtr> cells;
+        MAKE_PTR(DifferentiatedCellProliferativeType, p_differentiated_type);
+        CellsGenerator<UniformCellCycleModel, 2> cells_generator;
+        cells_generator.GenerateBasicRandom(cells, p_mesh->GetNumNodes(), p_differentiated_type);
+
+        // Make cells with x<5.0 apoptotic (so no source term)
+        boost::shared_ptr<AbstractCellProperty> p_apoptotic_property =
+                cells[0]->rGetCellPropertyCollection().GetCellPropertyRegistry()->Get<ApoptoticCellProperty>();
+        for (unsigned i=0; i<cells.size(); i++)
+        {
+            if (p_mesh->GetNode(i)->rGetLocation()[0] < 5.0)
+            {
+                cells[i]->AddCellProperty(p_apoptotic_property);
+            }
+        }
+
+        MeshBasedCellPopulation<2> cell_population(*p_mesh, cells);
+
+        SimulationTime::Instance()->SetEndTimeAndNumberOfTimeSteps(2.0, 2);
+
+        // Create PDE and boundary condition objects
+        MAKE_PTR_ARGS(AveragedSourceEllipticPde<2>, p_pde, (cell_population, -0.1));
+        MAKE_PTR_ARGS(ConstBoundaryCondition<2>, p_bc, (1.0));
+
+        ChastePoint<2> lower(-5.0, -5.0);
+        ChastePoint<2> upper(15.0, 15.0);
+        MAKE_PTR_ARGS(ChasteCuboid<2>, p_cuboid, (lower, upper));
+
+        // Create a PDE modifier that only solves the PDE every other time step
+        MAKE_PTR_ARGS(EllipticBoxDomainPdeModifier<2>, p_pde_modifier, (p_pde, p_bc, false, p_cuboid));
+        p_pde_modifier->SetDependentVariableName("variable");
+        p_pde_modifier->SetTimeStepsPerSolve(2);
+        p_pde_modifier->SetupSolve(cell_population, "TestWarmStartAndTimeStepsPerSolve");
+
+        CellPtr p_cell_0 = cell_population.GetCellUsingLocationIndex(0);
+        TS_ASSERT_DELTA(p_cell_0->GetCellData()->GetItem("variable"), 0.8605, 1e-4);
+        Vec p_first_solution = p_pde_modifier->GetSolution();
+
+        // The PDE is not solved on this time step, so the existing solution is kept
+        SimulationTime::Instance()->IncrementTimeOneStep();
+        p_pde_modifier->UpdateAtEndOfTimeStep(cell_population);
+        TS_ASSERT_EQUALS(p_pde_modifier->GetSolution(), p_first_solution);
+        TS_ASSERT_DELTA(p_cell_0->GetCellData()->GetItem("variable"), 0.8605, 1e-4);
+
+        // The PDE is solved on this time step, starting from the previous solution, which is already converged
+        SimulationTime::Instance()->IncrementTimeOneStep();
+        p_pde_modifier->UpdateAtEndOfTimeStep(cell_population);
+        TS_ASSERT_DIFFERS(p_pde_modifier->GetSolution(), p_first_solution);
+        TS_ASSERT_DELTA(p_cell_0->GetCellData()->GetItem("variable"), 0.8605, 1e-4);
+    }
+
+    void TestSolveEarlyWhenSourceTermsChange()
+    {
+        HoneycombMeshGenerator generator(10,10,0);
+        MutableMesh<2,2>* p_mesh = generator.GetMesh();
+
+        std::vector<CellPtr> cells;
+        MAKE_PTR(DifferentiatedCellProliferativeType, p_differentiated_type);
+        CellsGenerator<UniformCellCycleModel, 2> cells_generator;
+        cells_generator.GenerateBasicRandom(cells, p_mesh->GetNumNodes(), p_differentiated_type);
+
+        MeshBasedCellPopulation<2> cell_population(*p_mesh, cells);
+
+        SimulationTime::Instance()->SetEndTimeAndNumberOfTimeSteps(3.0, 3);
+
+        // Create PDE and boundary condition objects
+        MAKE_PTR_ARGS(AveragedSourceEllipticPde<2>, p_pde, (cell_population, -0.1));
+        MAKE_PTR_ARGS(ConstBoundaryCondition<2>, p_bc, (1.0));
+
+        ChastePoint<2> lower(-5.0, -5.0);
+        ChastePoint<2> upper(15.0, 15.0);
+        MAKE_PTR_ARGS(ChasteCuboid<2>, p_cuboid, (lower, upper));
+
+        // Create a PDE modifier that solves every third time step, or sooner if more than 5% of the cells have changed element
+        MAKE_PTR_ARGS(EllipticBoxDomainPdeModifier<2>, p_pde_modifier, (p_pde, p_bc, false, p_cuboid));
+        p_pde_modifier->SetDependentVariableName("variable");
+        p_pde_modifier->SetTimeStepsPerSolve(3);
+        p_pde_modifier->SetSourceTermChangeTolerance(0.05);
+        p_pde_modifier->SetupSolve(cell_population, "TestSolveEarlyWhenSourceTermsChange");
+        Vec p_first_solution = p_pde_modifier->GetSolution();
+
+        // The cells have not changed, so the PDE is not solved on this time step
+        SimulationTime::Instance()->IncrementTimeOneStep();
+        p_pde_modifier->UpdateAtEndOfTimeStep(cell_population);
+        TS_ASSERT_EQUALS(p_pde_modifier->GetSolution(), p_first_solution);
+
+        // Remove ten cells, which changes the source terms by 10%
+        for (unsigned i=0; i<10; i++)
+        {
+            cell_population.GetCellUsingLocationIndex(i)->Kill();
+        }
+        cell_population.RemoveDeadCells();
+        cell_population.Update();
+        TS_ASSERT_EQUALS(cell_population.GetNumRealCells(), 90u);
+
+        // So the PDE is solved before the next scheduled solve
+        SimulationTime::Instance()->IncrementTimeOneStep();
+        p_pde_modifier->UpdateAtEndOfTimeStep(cell_population);
+        TS_ASSERT_DIFFERS(p_pde_modifier->GetSolution(), p_first_solution);
+    }
+
+    void TestMultipleSpeciesOnSharedMesh()
+    {
+        HoneycombMeshGenerator generator(10,10,0);
+        MutableMesh<2,2>* p_mesh = generator.GetMesh();
+
+        std::vector<CellPtr> cells;
+        MAKE_PTR(DifferentiatedCellProliferativeType, p_differentiated_type);
+        CellsGenerator<UniformCellCycleModel, 2> cells_generator;
+        cells_generator.GenerateBasicRandom(cells, p_mesh->GetNumNodes(), p_differentiated_type);
+
+        // Make cells with x<5.0 apoptotic (so no source term)
+        boost::shared_ptr<AbstractCellProperty> p_apoptotic_property =
+                cells[0]->rGetCellPropertyCollection().GetCellPropertyRegistry()->Get<ApoptoticCellProperty>();
+        for (unsigned i=0; i<cells.size(); i++)
+        {
+            if (p_mesh->GetNode(i)->rGetLocation()[0] < 5.0)
+            {
+                cells[i]->AddCellProperty(p_apoptotic_property);
+            }
+        }
+
+        MeshBasedCellPopulation<2> cell_population(*p_mesh, cells);
+
+        SimulationTime::Instance()->SetEndTimeAndNumberOfTimeSteps(1.0, 1);
+
+        ChastePoint<2> lower(-5.0, -5.0);
+        ChastePoint<2> upper(15.0, 15.0);
+        MAKE_PTR_ARGS(ChasteCuboid<2>, p_cuboid, (lower, upper));
+
+        // The first species is passed to the constructor
+        MAKE_PTR_ARGS(AveragedSourceEllipticPde<2>, p_pde, (cell_population, -0.1));
+        MAKE_PTR_ARGS(ConstBoundaryCondition<2>, p_bc, (1.0));
+        MAKE_PTR_ARGS(EllipticBoxDomainPdeModifier<2>, p_pde_modifier, (p_pde, p_bc, false, p_cuboid));
+        p_pde_modifier->SetDependentVariableName("variable");
+        p_pde_modifier->SetOutputGradient(true);
+
+        // The second species is identical to the first, the third has no sources and a different boundary value
+        MAKE_PTR_ARGS(AveragedSourceEllipticPde<2>, p_pde2, (cell_population, -0.1));
+        p_pde_modifier->AddPde(p_pde2, p_bc, "variable2");
+        MAKE_PTR_ARGS(UniformSourceEllipticPde<2>, p_pde3, (0.0));
+        MAKE_PTR_ARGS(ConstBoundaryCondition<2>, p_bc3, (2.0));
+        p_pde_modifier->AddPde(p_pde3, p_bc3, "variable3");
+        TS_ASSERT_EQUALS(p_pde_modifier->GetNumAdditionalPdes(), 2u);
+
+        TS_ASSERT_THROWS_THIS(p_pde_modifier->AddPde(p_pde3, p_bc3, "variable"),
+                              "The dependent variable name variable is already in use.");
+        TS_ASSERT_THROWS_THIS(p_pde_modifier->AddPde(p_pde3, p_bc3, "variable2"),
+                              "The dependent variable name variable2 is already in use.");
+
+        p_pde_modifier->SetupSolve(cell_population, "TestMultipleSpeciesOnSharedMesh");
+
+        TS_ASSERT_EQUALS(ReplicatableVector(p_pde_modifier->GetAdditionalSolution(0)).GetSize(), 121u);
+        for (AbstractCellPopulation<2>::Iterator cell_iter = cell_population.Begin();
+             cell_iter != cell_population.End();
+             ++cell_iter)
+        {
+            boost::shared_ptr<CellData> p_data = cell_iter->GetCellData();
+            TS_ASSERT_DELTA(p_data->GetItem("variable2"), p_data->GetItem("variable"), 1e-8);
+            TS_ASSERT_DELTA(p_data->GetItem("variable2_grad_x"), p_data->GetItem("variable_grad_x"), 1e-8);
+            TS_ASSERT_DELTA(p_data->GetItem("variable2_grad_y"), p_data->GetItem("variable_grad_y"), 1e-8);
+            TS_ASSERT_DELTA(p_data->GetItem("variable3"), 2.0, 1e-6);
+            TS_ASSERT_DELTA(p_data->GetItem("variable3_grad_x"), 0.0, 1e-6);
+        }
+
+        CellPtr p_cell_0 = cell_population.GetCellUsingLocationIndex(0);
+        TS_ASSERT_DELTA(p_cell_0->GetCellData()->GetItem("variable2"), 0.8605, 1e-4);
+    }
+
     void TestNodeBasedSquareMonolayer()
     {
         HoneycombMeshGenerator generator(10,10,0);
@@ -520,6 +520,66 @@ public:
         TS_ASSERT_DELTA(p_cell_210->GetCellData()->GetItem("variable"), 0.4542, 1e-4);
     }
 
+    void TestInitialGuessAfterChangeInNumberOfCells()
+    {
+        HoneycombMeshGenerator generator(10,10,0);
+        MutableMesh<2,2>* p_mesh = generator.GetMesh();
+
+        std::vector<CellPtr> cells;
+        MAKE_PTR(DifferentiatedCellProliferativeType, p_differentiated_type);
+        CellsGenerator<UniformCellCycleModel, 2> cells_generator;
+        cells_generator.GenerateBasicRandom(cells, p_mesh->GetNumNodes(), p_differentiated_type);
+
+        MeshBasedCellPopulation<2> cell_population(*p_mesh, cells);
+
+        // Set up simulation time for file output
+        SimulationTime::Instance()->SetEndTimeAndNumberOfTimeSteps(1.0, 1);
+
+        // Create PDE and boundary condition objects
+        MAKE_PTR_ARGS(CellwiseSourceEllipticPde<2>, p_pde, (cell_population, -0.1));
+        MAKE_PTR_ARGS(ConstBoundaryCondition<2>, p_bc, (1.0));
+
+        MAKE_PTR_ARGS(EllipticGrowingDomainPdeModifier<2>, p_pde_modifier, (p_pde, p_bc, false));
+        p_pde_modifier->SetDependentVariableName("variable");
+        p_pde_modifier->SetupSolve(cell_population, "TestEllipticInitialGuessAfterChangeInNumberOfCells");
+
+        // Remove a cell, so that the previous solution is the wrong size to be used directly as an initial guess
+        cell_population.GetCellUsingLocationIndex(0)->Kill();
+        cell_population.RemoveDeadCells();
+        cell_population.Update();
+        TS_ASSERT_EQUALS(cell_population.GetNumRealCells(), 99u);
+
+        // The previous solution is interpolated onto the new mesh using CellData to give the initial guess
+        p_pde_modifier->UpdateAtEndOfTimeStep(cell_population);
+
+        PetscInt solution_size;
+        VecGetSize(p_pde_modifier->GetSolution(), &solution_size);
+        TS_ASSERT_EQUALS((unsigned)solution_size, 99u);
+
+        // Compare with a solve that has no initial guess
+        ReplicatableVector solution_repl(p_pde_modifier->GetSolution());
+        std::vector<double> solution_with_initial_guess;
+        for (unsigned i=0; i<solution_repl.GetSize(); i++)
+        {
+            solution_with_initial_guess.push_back(solution_repl[i]);
+        }
+
+        MAKE_PTR_ARGS(EllipticGrowingDomainPdeModifier<2>, p_pde_modifier_2, (p_pde, p_bc, false));
+        p_pde_modifier_2->SetDependentVariableName("variable");
+        p_pde_modifier_2->UpdateAtEndOfTimeStep(cell_population);
+
+        ReplicatableVector solution_repl_2(p_pde_modifier_2->GetSolution());
+        TS_ASSERT_EQUALS(solution_repl_2.GetSize(), solution_with_initial_guess.size());
+        for (unsigned i=0; i<solution_repl_2.GetSize(); i++)
+        {
+            TS_ASSERT_DELTA(solution_with_initial_guess[i], solution_repl_2[i], 1e-4);
+        }
+
+        // The interpolated initial guess should save linear solver iterations
+        TS_ASSERT_LESS_THAN(p_pde_modifier->GetNumLinearSolverIterations(),
+                            p_pde_modifier_2->GetNumLinearSolverIterations());
+    }
+
     void TestNodeBasedSquareMonolayer()
     {
         HoneycombMeshGenerator generator(20,20,0);
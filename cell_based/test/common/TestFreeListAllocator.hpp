@@ -0,0 +1,88 @@
+/*
+
+Copyright (c) 2005-2017, University of Oxford.
+All rights reserved.
+
+University of Oxford means the Chancellor, Masters and Scholars of the
+University of Oxford, having an administrative office at Wellington
+Square, Oxford OX1 2JD, UK.
+
+This file is part of Chaste.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+ * Redistributions of source code must retain the above copyright notice,
+   this list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+ * Neither the name of the University of Oxford nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#ifndef TESTFREELISTALLOCATOR_HPP_
+#define TESTFREELISTALLOCATOR_HPP_
+
+#include <cxxtest/TestSuite.h>
+
+#include "FreeListAllocator.hpp"
+
+#include "FakePetscSetup.hpp"
+
+class TestFreeListAllocator : public CxxTest::TestSuite
+{
+public:
+
+    void TestAllocateAndRecycle()
+    {
+        FreeListAllocator allocator(sizeof(double));
+        TS_ASSERT_EQUALS(allocator.GetNumFreeBlocks(), 0u);
+        TS_ASSERT_EQUALS(allocator.CanRecycle(sizeof(double)), false);
+
+        void* p_first = allocator.Allocate(sizeof(double));
+        void* p_second = allocator.Allocate(sizeof(double));
+        TS_ASSERT_DIFFERS(p_first, p_second);
+
+        // Freed blocks are kept for reuse
+        allocator.Deallocate(p_first, sizeof(double));
+        allocator.Deallocate(p_second, sizeof(double));
+        TS_ASSERT_EQUALS(allocator.GetNumFreeBlocks(), 2u);
+        TS_ASSERT_EQUALS(allocator.CanRecycle(sizeof(double)), true);
+
+        // The most recently freed block is reused first
+        void* p_third = allocator.Allocate(sizeof(double));
+        TS_ASSERT_EQUALS(p_third, p_second);
+        TS_ASSERT_EQUALS(allocator.GetNumFreeBlocks(), 1u);
+
+        // Blocks of other sizes are not recycled
+        TS_ASSERT_EQUALS(allocator.CanRecycle(2*sizeof(double)), false);
+        void* p_large = allocator.Allocate(2*sizeof(double));
+        allocator.Deallocate(p_large, 2*sizeof(double));
+        TS_ASSERT_EQUALS(allocator.GetNumFreeBlocks(), 1u);
+
+        // Freeing a null pointer does nothing
+        allocator.Deallocate(nullptr, sizeof(double));
+        TS_ASSERT_EQUALS(allocator.GetNumFreeBlocks(), 1u);
+
+        allocator.ReleaseFreeBlocks();
+        TS_ASSERT_EQUALS(allocator.GetNumFreeBlocks(), 0u);
+
+        // The remaining block is returned to the heap by the allocator's destructor
+        allocator.Deallocate(p_third, sizeof(double));
+    }
+};
+
+#endif /*TESTFREELISTALLOCATOR_HPP_*/
@@ -1778,6 +1778,49 @@ public:
         TS_ASSERT_EQUALS(p_mesh->GetNumNodes(), 2u);
     }
 
+    void TestFlatNeighbourTables()
+    {
+        // Create a 4x4 lattice with one 2x2 element
+        PottsMeshGenerator<2> generator(4, 1, 2, 4, 1, 2);
+        PottsMesh<2>* p_mesh = generator.GetMesh();
+
+        // The flat tables agree with the neighbour sets, in increasing order of index
+        for (unsigned node_index=0; node_index<p_mesh->GetNumNodes(); node_index++)
+        {
+            std::set<unsigned> moore = p_mesh->GetMooreNeighbouringNodeIndices(node_index);
+            TS_ASSERT_EQUALS(p_mesh->GetNumMooreNeighbours(node_index), moore.size());
+            unsigned neighbour = 0;
+            for (std::set<unsigned>::iterator iter = moore.begin(); iter != moore.end(); ++iter)
+            {
+                TS_ASSERT_EQUALS(p_mesh->GetMooreNeighbour(node_index, neighbour), *iter);
+                neighbour++;
+            }
+
+            std::set<unsigned> von_neumann = p_mesh->GetVonNeumannNeighbouringNodeIndices(node_index);
+            TS_ASSERT_EQUALS(p_mesh->GetNumVonNeumannNeighbours(node_index), von_neumann.size());
+            neighbour = 0;
+            for (std::set<unsigned>::iterator iter = von_neumann.begin(); iter != von_neumann.end(); ++iter)
+            {
+                TS_ASSERT_EQUALS(p_mesh->GetVonNeumannNeighbour(node_index, neighbour), *iter);
+                neighbour++;
+            }
+        }
+
+        // Corner and interior nodes
+        TS_ASSERT_EQUALS(p_mesh->GetNumMooreNeighbours(0), 3u);
+        TS_ASSERT_EQUALS(p_mesh->GetNumVonNeumannNeighbours(0), 2u);
+        TS_ASSERT_EQUALS(p_mesh->GetNumMooreNeighbours(5), 8u);
+        TS_ASSERT_EQUALS(p_mesh->GetNumVonNeumannNeighbours(5), 4u);
+        TS_ASSERT_EQUALS(p_mesh->GetVonNeumannNeighbour(5, 0), 1u);
+        TS_ASSERT_EQUALS(p_mesh->GetVonNeumannNeighbour(5, 3), 9u);
+
+        // The tables are rebuilt when the connectivity changes
+        p_mesh->DeleteNode(15);
+        TS_ASSERT_EQUALS(p_mesh->GetNumMooreNeighbours(10), 7u);
+        TS_ASSERT_EQUALS(p_mesh->GetNumVonNeumannNeighbours(14), 2u);
+        TS_ASSERT_EQUALS(p_mesh->GetNumVonNeumannNeighbours(11), 2u);
+    }
+
     void TestArchive2dPottsMesh()
     {
         EXIT_IF_PARALLEL;
@@ -56,6 +56,7 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "SmartPointers.hpp"
 #include "CellLabel.hpp"
 #include "FileComparison.hpp"
+#include "RandomNumberGenerator.hpp"
 
 // Cell writers
 #include "CellAgesWriter.hpp"
@@ -731,6 +732,53 @@ public:
 
         std::set<unsigned> neighbours_of_cell_0 = cell_population.GetNeighbouringLocationIndices(*(cell_population.Begin()));
         TS_ASSERT(neighbours_of_cell_0 == expected_neighbours_of_cell_0);
+
+        // Test FillNeighbouringLocationIndices() method
+        std::vector<unsigned> neighbours_vector;
+        cell_population.FillNeighbouringLocationIndices(*(cell_population.Begin()), neighbours_vector);
+        TS_ASSERT_EQUALS(neighbours_vector.size(), 3u);
+        TS_ASSERT(std::equal(neighbours_vector.begin(), neighbours_vector.end(), expected_neighbours_of_cell_0.begin()));
+    }
+
+    void TestUpdateCellLocationsMatchesSetBasedSweep()
+    {
+        /*
+         * UpdateCellLocations() reads neighbours from the flat tables in PottsMesh.
+         * Check that it reproduces the cell locations recorded from the original
+         * sweep over the std::set returned by GetMooreNeighbouringNodeIndices().
+         * (Sensitive to changes in random number generation)
+         */
+        unsigned initial_locations[5] = {6, 7, 8, 12, 16};
+        unsigned expected_locations[5] = {3, 8, 18, 5, 15};
+
+        PottsMeshGenerator<2> generator(5, 0, 0, 5, 0, 0);
+        PottsMesh<2>* p_mesh = generator.GetMesh();
+
+        std::vector<CellPtr> cells;
+        CellsGenerator<FixedG1GenerationalCellCycleModel, 2> cells_generator;
+        cells_generator.GenerateBasic(cells, 5);
+        std::vector<unsigned> location_indices(initial_locations, initial_locations + 5);
+
+        CaBasedCellPopulation<2> cell_population(*p_mesh, cells, location_indices);
+
+        MAKE_PTR(DiffusionCaUpdateRule<2>, p_diffusion_update_rule);
+        p_diffusion_update_rule->SetDiffusionParameter(1.0);
+        cell_population.AddUpdateRule(p_diffusion_update_rule);
+
+        RandomNumberGenerator::Instance()->Reseed(0);
+        for (unsigned sweep=0; sweep<20; sweep++)
+        {
+            cell_population.UpdateCellLocations(0.1);
+        }
+
+        unsigned i = 0;
+        for (AbstractCellPopulation<2>::Iterator cell_iter = cell_population.Begin();
+             cell_iter != cell_population.End();
+             ++cell_iter, ++i)
+        {
+            TS_ASSERT_EQUALS(cell_population.GetLocationIndexUsingCell(*cell_iter), expected_locations[i]);
+        }
+        TS_ASSERT_EQUALS(i, 5u);
     }
 
     void TestUpdateCellLocationsRandomlyExceptions()
@@ -38,6 +38,8 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <cxxtest/TestSuite.h>
 
+#include <algorithm>
+
 #include <boost/archive/text_oarchive.hpp>
 #include <boost/archive/text_iarchive.hpp>
 
@@ -578,6 +580,16 @@ public:
         std::set<unsigned> neighbours_of_cell_0 = cell_population.GetNeighbouringLocationIndices(p_cell_50);
         TS_ASSERT(neighbours_of_cell_0 == expected_node_50_neighbours);
 
+        // Test FillNeighbouringNodeIndices() and FillNeighbouringLocationIndices() methods
+        std::vector<unsigned> neighbours_vector;
+        cell_population.FillNeighbouringNodeIndices(50, neighbours_vector);
+        TS_ASSERT_EQUALS(neighbours_vector.size(), expected_node_50_neighbours.size());
+        TS_ASSERT(std::equal(neighbours_vector.begin(), neighbours_vector.end(), expected_node_50_neighbours.begin()));
+
+        cell_population.FillNeighbouringLocationIndices(p_cell_50, neighbours_vector);
+        TS_ASSERT_EQUALS(neighbours_vector.size(), expected_node_50_neighbours.size());
+        TS_ASSERT(std::equal(neighbours_vector.begin(), neighbours_vector.end(), expected_node_50_neighbours.begin()));
+
         p_simulation_time->IncrementTimeOneStep();
 
         unsigned num_removed = cell_population.RemoveDeadCells();
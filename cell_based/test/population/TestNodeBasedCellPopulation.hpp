@@ -858,6 +858,15 @@ public:
 
             TS_ASSERT_EQUALS(node_4_neighbours.size(), expected_node_4_neighbours.size());
             TS_ASSERT_EQUALS(node_4_neighbours, expected_node_4_neighbours);
+
+            // Test FillNeighbouringNodeIndices() method, which reuses the same vector
+            std::vector<unsigned> neighbours_vector;
+            node_based_cell_population.FillNeighbouringNodeIndices(4, neighbours_vector);
+            TS_ASSERT_EQUALS(neighbours_vector.size(), expected_node_4_neighbours.size());
+            TS_ASSERT(std::equal(neighbours_vector.begin(), neighbours_vector.end(), expected_node_4_neighbours.begin()));
+
+            node_based_cell_population.FillNeighbouringNodeIndices(0, neighbours_vector);
+            TS_ASSERT(neighbours_vector.empty());
         }
     }
 
@@ -1629,6 +1638,64 @@ public:
         }
     }
 
+    void TestSortNodesAndCellsAlongSpaceFillingCurve()
+    {
+        EXIT_IF_PARALLEL;
+
+        SimulationTime* p_simulation_time = SimulationTime::Instance();
+        p_simulation_time->SetEndTimeAndNumberOfTimeSteps(10.0, 1);
+
+        // Create a simple mesh
+        TrianglesMeshReader<2,2> mesh_reader("mesh/test/data/square_128_elements");
+        TetrahedralMesh<2,2> generating_mesh;
+        generating_mesh.ConstructFromMeshReader(mesh_reader);
+
+        NodesOnlyMesh<2> mesh;
+        mesh.ConstructNodesWithoutMesh(generating_mesh, 1.2);
+
+        std::vector<CellPtr> cells;
+        CellsGenerator<FixedG1GenerationalCellCycleModel, 2> cells_generator;
+        cells_generator.GenerateBasic(cells, mesh.GetNumNodes());
+
+        NodeBasedCellPopulation<2> cell_population(mesh, cells);
+
+        TS_ASSERT_EQUALS(cell_population.GetSpatialSortFrequency(), 0u);
+        cell_population.SetSpatialSortFrequency(1);
+        TS_ASSERT_EQUALS(cell_population.GetSpatialSortFrequency(), 1u);
+
+        // Record the location associated with each cell
+        std::map<Cell*, unsigned> old_location_indices;
+        for (AbstractCellPopulation<2>::Iterator cell_iter = cell_population.Begin();
+             cell_iter != cell_population.End();
+             ++cell_iter)
+        {
+            old_location_indices[cell_iter->get()] = cell_population.GetLocationIndexUsingCell(*cell_iter);
+        }
+
+        // Update() reorders the nodes and cells, since the spatial sort frequency is one
+        cell_population.Update();
+
+        TS_ASSERT_EQUALS(cell_population.GetNumRealCells(), 81u);
+        TS_ASSERT_EQUALS(cell_population.GetNumNodes(), 81u);
+
+        // Each cell keeps its location index, and cells are iterated over in node storage order
+        unsigned index = 0;
+        for (AbstractCellPopulation<2>::Iterator cell_iter = cell_population.Begin();
+             cell_iter != cell_population.End();
+             ++cell_iter)
+        {
+            unsigned global_index = cell_population.GetLocationIndexUsingCell(*cell_iter);
+            TS_ASSERT_EQUALS(global_index, old_location_indices[cell_iter->get()]);
+            TS_ASSERT_EQUALS(mesh.SolveNodeMapping(global_index), index);
+            index++;
+        }
+
+        // The first cell visited is at the bottom-left corner of the square
+        c_vector<double, 2> first_location = cell_population.GetLocationOfCellCentre(*(cell_population.Begin()));
+        TS_ASSERT_DELTA(first_location[0], 0.0, 1e-6);
+        TS_ASSERT_DELTA(first_location[1], 0.0, 1e-6);
+    }
+
     void TestGetTetrahedralMeshForPdeModifier()
     {
         EXIT_IF_PARALLEL;  // The population.GetTetrahedralMeshForPdeModifier() method does not yet work in parallel.
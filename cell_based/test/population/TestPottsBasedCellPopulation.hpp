@@ -44,6 +44,8 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "CellsGenerator.hpp"
 #include "PottsBasedCellPopulation.hpp"
 #include "VolumeConstraintPottsUpdateRule.hpp"
+#include "SurfaceAreaConstraintPottsUpdateRule.hpp"
+#include "AbstractPottsUpdateRule.hpp"
 #include "PottsMeshGenerator.hpp"
 #include "FixedG1GenerationalCellCycleModel.hpp"
 #include "AbstractCellBasedTestSuite.hpp"
@@ -69,6 +71,67 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 //This test is always run sequentially (never in parallel)
 #include "FakePetscSetup.hpp"
 
+/**
+ * A Potts update rule that makes no contribution to the Hamiltonian. Each time it is
+ * evaluated during a sweep, it compares the element volumes and surface areas reported
+ * by the cell population, which are then read from its incrementally updated cache,
+ * with a full recomputation from the mesh.
+ */
+class ElementGeometryCheckingPottsUpdateRule : public AbstractPottsUpdateRule<2>
+{
+private:
+
+    /** The number of times the element geometry has been checked. */
+    unsigned mNumChecks;
+
+    /** The largest difference between a cached and a recomputed element volume. */
+    double mMaxVolumeError;
+
+    /** The largest difference between a cached and a recomputed element surface area. */
+    double mMaxSurfaceAreaError;
+
+public:
+
+    ElementGeometryCheckingPottsUpdateRule()
+        : AbstractPottsUpdateRule<2>(),
+          mNumChecks(0),
+          mMaxVolumeError(0.0),
+          mMaxSurfaceAreaError(0.0)
+    {
+    }
+
+    double EvaluateHamiltonianContribution(unsigned currentNodeIndex,
+                                           unsigned targetNodeIndex,
+                                           PottsBasedCellPopulation<2>& rCellPopulation)
+    {
+        PottsMesh<2>& r_mesh = rCellPopulation.rGetMesh();
+        for (unsigned elem_index=0; elem_index<r_mesh.GetNumElements(); elem_index++)
+        {
+            mMaxVolumeError = std::max(mMaxVolumeError,
+                fabs(rCellPopulation.GetVolumeOfElement(elem_index) - r_mesh.GetVolumeOfElement(elem_index)));
+            mMaxSurfaceAreaError = std::max(mMaxSurfaceAreaError,
+                fabs(rCellPopulation.GetSurfaceAreaOfElement(elem_index) - r_mesh.GetSurfaceAreaOfElement(elem_index)));
+        }
+        mNumChecks++;
+        return 0.0;
+    }
+
+    unsigned GetNumChecks()
+    {
+        return mNumChecks;
+    }
+
+    double GetMaxVolumeError()
+    {
+        return mMaxVolumeError;
+    }
+
+    double GetMaxSurfaceAreaError()
+    {
+        return mMaxSurfaceAreaError;
+    }
+};
+
 class TestPottsBasedCellPopulation : public AbstractCellBasedTestSuite
 {
 public:
@@ -421,6 +484,45 @@ public:
         TS_ASSERT_EQUALS(cell_population.rGetMesh().GetElement(1)->GetNumNodes(), 4u);
     }
 
+    void TestIncrementalElementGeometry()
+    {
+        // Create a 2D PottsMesh with four cells surrounded by medium
+        PottsMeshGenerator<2> generator(10, 2, 3, 10, 2, 3);
+        PottsMesh<2>* p_mesh = generator.GetMesh();
+
+        // Create cells
+        std::vector<CellPtr> cells;
+        CellsGenerator<FixedG1GenerationalCellCycleModel, 2> cells_generator;
+        cells_generator.GenerateBasic(cells, p_mesh->GetNumElements());
+
+        // Create cell population
+        PottsBasedCellPopulation<2> cell_population(*p_mesh, cells);
+        cell_population.SetTemperature(10.0);
+        cell_population.SetNumSweepsPerTimestep(5);
+
+        // Outside UpdateCellLocations() element geometry is computed by the mesh
+        TS_ASSERT_DELTA(cell_population.GetVolumeOfElement(0), 9.0, 1e-12);
+        TS_ASSERT_DELTA(cell_population.GetSurfaceAreaOfElement(0), 12.0, 1e-12);
+
+        MAKE_PTR(VolumeConstraintPottsUpdateRule<2>, p_volume_constraint_update_rule);
+        cell_population.AddUpdateRule(p_volume_constraint_update_rule);
+        MAKE_PTR(SurfaceAreaConstraintPottsUpdateRule<2>, p_surface_area_update_rule);
+        cell_population.AddUpdateRule(p_surface_area_update_rule);
+
+        // Compare the cached geometry with the mesh while the sweeps are in progress
+        MAKE_PTR(ElementGeometryCheckingPottsUpdateRule, p_checking_update_rule);
+        cell_population.AddUpdateRule(p_checking_update_rule);
+        cell_population.UpdateCellLocations(1.0);
+
+        TS_ASSERT_LESS_THAN(0u, p_checking_update_rule->GetNumChecks());
+        TS_ASSERT_DELTA(p_checking_update_rule->GetMaxVolumeError(), 0.0, 1e-12);
+        TS_ASSERT_DELTA(p_checking_update_rule->GetMaxSurfaceAreaError(), 0.0, 1e-12);
+
+        // Check the incrementally updated volumes and surface areas after every accepted flip
+        cell_population.SetValidateElementGeometryCache(true);
+        TS_ASSERT_THROWS_NOTHING(cell_population.UpdateCellLocations(1.0));
+    }
+
     ///\todo implement this test (#1666)
 //    void TestVoronoiMethods()
 //    {
@@ -62,6 +62,7 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "LogFile.hpp"
 #include "SmartPointers.hpp"
 #include "CellMutationStatesCountWriter.hpp"
+#include "PlaneBoundaryCondition.hpp"
 #include "FakePetscSetup.hpp"
 
 class TestOffLatticeSimulationWithVertexBasedCellPopulation : public AbstractCellBasedWithTimingsTestSuite
@@ -356,6 +357,70 @@ public:
         Warnings::QuietDestroy();
     }
 
+    void TestElementGeometryCacheInSimulation()
+    {
+        // Create a simple 2D MutableVertexMesh
+        HoneycombVertexMeshGenerator generator(3, 3);
+        MutableVertexMesh<2,2>* p_mesh = generator.GetMesh();
+        TS_ASSERT_EQUALS(p_mesh->GetUseElementGeometryCache(), false);
+
+        // Create cells
+        std::vector<CellPtr> cells;
+        MAKE_PTR(DifferentiatedCellProliferativeType, p_diff_type);
+        CellsGenerator<FixedG1GenerationalCellCycleModel, 2> cells_generator;
+        cells_generator.GenerateBasic(cells, p_mesh->GetNumElements(), std::vector<unsigned>(), p_diff_type);
+
+        // Create cell population
+        VertexBasedCellPopulation<2> cell_population(*p_mesh, cells);
+
+        // Set up cell-based simulation
+        OffLatticeSimulation<2> simulator(cell_population);
+        simulator.SetOutputDirectory("TestElementGeometryCacheInSimulation");
+        simulator.SetEndTime(0.05);
+
+        MAKE_PTR(NagaiHondaForce<2>, p_nagai_honda_force);
+        simulator.AddForce(p_nagai_honda_force);
+        MAKE_PTR(SimpleTargetAreaModifier<2>, p_growth_modifier);
+        simulator.AddSimulationModifier(p_growth_modifier);
+
+        // This boundary condition moves nodes directly, so the simulation must invalidate the cache
+        c_vector<double,2> point = zero_vector<double>(2);
+        point(1) = 0.5;
+        c_vector<double,2> normal = zero_vector<double>(2);
+        normal(1) = -1.0;
+        MAKE_PTR_ARGS(PlaneBoundaryCondition<2>, p_bc, (&cell_population, point, normal));
+        simulator.AddCellPopulationBoundaryCondition(p_bc);
+
+        simulator.Solve();
+
+        // The simulation switches the cache on, and the forces and modifier reuse it
+        TS_ASSERT_EQUALS(p_mesh->GetUseElementGeometryCache(), true);
+        TS_ASSERT_LESS_THAN(0u, p_mesh->GetNumElementGeometryCacheHits());
+
+        // Nothing cached at the end of the simulation is stale
+        std::vector<double> cached_volumes;
+        std::vector<double> cached_perimeters;
+        for (unsigned elem_index=0; elem_index<p_mesh->GetNumElements(); elem_index++)
+        {
+            cached_volumes.push_back(p_mesh->GetVolumeOfElement(elem_index));
+            cached_perimeters.push_back(p_mesh->GetSurfaceAreaOfElement(elem_index));
+        }
+        p_mesh->SetUseElementGeometryCache(false);
+        for (unsigned elem_index=0; elem_index<p_mesh->GetNumElements(); elem_index++)
+        {
+            TS_ASSERT_DELTA(cached_volumes[elem_index], p_mesh->GetVolumeOfElement(elem_index), 1e-12);
+            TS_ASSERT_DELTA(cached_perimeters[elem_index], p_mesh->GetSurfaceAreaOfElement(elem_index), 1e-12);
+        }
+
+        // The boundary condition has been applied
+        for (unsigned node_index=0; node_index<p_mesh->GetNumNodes(); node_index++)
+        {
+            TS_ASSERT_LESS_THAN_EQUALS(0.5 - 1e-12, p_mesh->GetNode(node_index)->rGetLocation()[1]);
+        }
+
+        Warnings::QuietDestroy();
+    }
+
     // This test uses a larger timestep to run faster.
     void TestVertexMonolayerWithVoid()
     {
@@ -48,6 +48,7 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "PetscVecTools.hpp"
 #include "PetscMatTools.hpp"
 #include "GaussianQuadratureRule.hpp"
+#include "TabulatedBasisFunctions.hpp"
 
 
 /**
@@ -112,6 +113,9 @@ protected:
     /** Quadrature rule for volume integrals */
     GaussianQuadratureRule<DIM>* mpQuadRule;
 
+    /** The basis functions evaluated at the points of #mpQuadRule. */
+    TabulatedBasisFunctions<DIM>* mpTabulatedBasisFunctions;
+
     /**
      * The main assembly method. Protected, should only be called through Assemble(),
      * AssembleMatrix() or AssembleVector() which set mAssembleMatrix, mAssembleVector
@@ -309,6 +313,7 @@ public:
         // In general the Jacobian for a mechanics problem is non-polynomial.
         // We therefore use the highest order integration rule available
         mpQuadRule = new GaussianQuadratureRule<DIM>(3);
+        mpTabulatedBasisFunctions = new TabulatedBasisFunctions<DIM>(*mpQuadRule);
     }
 
 //    void SetCurrentSolution(Vec currentSolution);
@@ -319,6 +324,7 @@ public:
     virtual ~AbstractContinuumMechanicsAssembler()
     {
         delete mpQuadRule;
+        delete mpTabulatedBasisFunctions;
     }
 };
 
@@ -474,9 +480,9 @@ void AbstractContinuumMechanicsAssembler<DIM,CAN_ASSEMBLE_VECTOR,CAN_ASSEMBLE_MA
         const ChastePoint<DIM>& quadrature_point = mpQuadRule->rGetQuadPoint(quadrature_index);
 
         // Set up basis function info
-        LinearBasisFunction<DIM>::ComputeBasisFunctions(quadrature_point, linear_phi);
-        QuadraticBasisFunction<DIM>::ComputeBasisFunctions(quadrature_point, quad_phi);
-        QuadraticBasisFunction<DIM>::ComputeTransformedBasisFunctionDerivatives(quadrature_point, inverse_jacobian, grad_quad_phi);
+        linear_phi = mpTabulatedBasisFunctions->rGetLinearBasisFunctions(quadrature_index);
+        quad_phi = mpTabulatedBasisFunctions->rGetQuadraticBasisFunctions(quadrature_index);
+        mpTabulatedBasisFunctions->ComputeTransformedQuadraticBasisFunctionDerivatives(quadrature_index, inverse_jacobian, grad_quad_phi);
         LinearBasisFunction<DIM>::ComputeTransformedBasisFunctionDerivatives(quadrature_point, inverse_jacobian, grad_linear_phi);
 
         // interpolate X (ie physical location of this quad point).
@@ -47,6 +47,7 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "Warnings.hpp"
 #include "PetscException.hpp"
 #include "GaussianQuadratureRule.hpp"
+#include "TabulatedBasisFunctions.hpp"
 #include "PetscTools.hpp"
 #include "MechanicsEventHandler.hpp"
 #include "CommandLineArguments.hpp"
@@ -128,6 +129,9 @@ protected:
     /** Gaussian quadrature rule. */
     GaussianQuadratureRule<DIM>* mpQuadratureRule;
 
+    /** The basis functions evaluated at the points of #mpQuadratureRule. */
+    TabulatedBasisFunctions<DIM>* mpTabulatedBasisFunctions;
+
     /** Boundary Gaussian quadrature rule. */
     GaussianQuadratureRule<DIM-1>* mpBoundaryQuadratureRule;
 
@@ -201,11 +205,30 @@ protected:
      */
     Mat mPreconditionMatrix;
 
+    /**
+     * Whether the matrices are given block size DIM, so that the unknowns of each node form a block.
+     * See SetUseNodalBlockSize().
+     */
+    bool mUseNodalBlockSize;
+
     /**
      * Allocates memory for the matrices and vectors
      */
     void AllocateMatrixMemory();
 
+    /**
+     * Whether to give the matrices block size DIM, so that algebraic multigrid preconditioners
+     * aggregate the unknowns of each node together. This only affects compressible problems,
+     * where the unknowns of each node are contiguous, and needs PETSc 3.3 or later.
+     *
+     * The block size of a matrix has to be set before its memory is preallocated, so when
+     * this changes the matrices and vectors are destroyed and allocated again. It should
+     * therefore be called before solving.
+     *
+     * @param useNodalBlockSize whether to use block size DIM
+     */
+    void SetUseNodalBlockSize(bool useNodalBlockSize);
+
 
     /**
      * Apply the Dirichlet boundary conditions to the linear system.
@@ -382,11 +405,13 @@ AbstractContinuumMechanicsSolver<DIM>::AbstractContinuumMechanicsSolver(Abstract
       mOutputDirectory(outputDirectory),
       mpOutputFileHandler(nullptr),
       mpQuadratureRule(nullptr),
+      mpTabulatedBasisFunctions(nullptr),
       mpBoundaryQuadratureRule(nullptr),
       mCompressibilityType(compressibilityType),
       mResidualVector(nullptr),
       mSystemLhsMatrix(nullptr),
-      mPreconditionMatrix(nullptr)
+      mPreconditionMatrix(nullptr),
+      mUseNodalBlockSize(false)
 {
     assert(DIM==2 || DIM==3);
 
@@ -419,6 +444,7 @@ AbstractContinuumMechanicsSolver<DIM>::AbstractContinuumMechanicsSolver(Abstract
     // In general the Jacobian for a mechanics problem is non-polynomial.
     // We therefore use the highest order integration rule available.
     mpQuadratureRule = new GaussianQuadratureRule<DIM>(3);
+    mpTabulatedBasisFunctions = new TabulatedBasisFunctions<DIM>(*mpQuadratureRule);
     // The boundary forcing terms (or tractions) are also non-polynomial in general.
     // Again, we use the highest order integration rule available.
     mpBoundaryQuadratureRule = new GaussianQuadratureRule<DIM-1>(3);
@@ -437,6 +463,7 @@ AbstractContinuumMechanicsSolver<DIM>::~AbstractContinuumMechanicsSolver()
     if (mpQuadratureRule)
     {
         delete mpQuadratureRule;
+        delete mpTabulatedBasisFunctions;
         delete mpBoundaryQuadratureRule;
     }
 
@@ -853,8 +880,45 @@ void AbstractContinuumMechanicsSolver<DIM>::AllocateMatrixMemory()
         // 2D: N elements around a point => 7N+3 non-zeros in that row? Assume N<=10 (structured mesh would have N_max=6) => 73.
         unsigned num_non_zeros = std::min(75u, mNumDofs);
 
-        PetscTools::SetupMat(mSystemLhsMatrix, mNumDofs, mNumDofs, num_non_zeros, local_size, local_size);
-        PetscTools::SetupMat(mPreconditionMatrix, mNumDofs, mNumDofs, num_non_zeros, local_size, local_size);
+#if (PETSC_VERSION_MAJOR == 3 && PETSC_VERSION_MINOR >= 3) //PETSc 3.3 or later
+        if (mUseNodalBlockSize && mCompressibilityType==COMPRESSIBLE)
+        {
+            // The block size has to be set before preallocation, so PetscTools::SetupMat() can't be used here
+            MatCreate(PETSC_COMM_WORLD,&mSystemLhsMatrix);
+            MatCreate(PETSC_COMM_WORLD,&mPreconditionMatrix);
+            MatSetSizes(mSystemLhsMatrix,local_size,local_size,mNumDofs,mNumDofs);
+            MatSetSizes(mPreconditionMatrix,local_size,local_size,mNumDofs,mNumDofs);
+
+            // The unknowns of each node form a block; AMG preconditioners use this to aggregate them together
+            MatSetBlockSize(mSystemLhsMatrix, DIM);
+            MatSetBlockSize(mPreconditionMatrix, DIM);
+
+            if (PetscTools::IsSequential())
+            {
+                MatSetType(mSystemLhsMatrix, MATSEQAIJ);
+                MatSetType(mPreconditionMatrix, MATSEQAIJ);
+                MatSeqAIJSetPreallocation(mSystemLhsMatrix,    num_non_zeros, PETSC_NULL);
+                MatSeqAIJSetPreallocation(mPreconditionMatrix, num_non_zeros, PETSC_NULL);
+            }
+            else
+            {
+                MatSetType(mSystemLhsMatrix, MATMPIAIJ);
+                MatSetType(mPreconditionMatrix, MATMPIAIJ);
+                MatMPIAIJSetPreallocation(mSystemLhsMatrix,    num_non_zeros, PETSC_NULL, num_non_zeros, PETSC_NULL);
+                MatMPIAIJSetPreallocation(mPreconditionMatrix, num_non_zeros, PETSC_NULL, num_non_zeros, PETSC_NULL);
+            }
+
+            MatSetFromOptions(mSystemLhsMatrix);
+            MatSetFromOptions(mPreconditionMatrix);
+            MatSetOption(mSystemLhsMatrix, MAT_IGNORE_OFF_PROC_ENTRIES, PETSC_TRUE);
+            MatSetOption(mPreconditionMatrix, MAT_IGNORE_OFF_PROC_ENTRIES, PETSC_TRUE);
+        }
+        else
+#endif
+        {
+            PetscTools::SetupMat(mSystemLhsMatrix, mNumDofs, mNumDofs, num_non_zeros, local_size, local_size);
+            PetscTools::SetupMat(mPreconditionMatrix, mNumDofs, mNumDofs, num_non_zeros, local_size, local_size);
+        }
     }
     else
     {
@@ -923,6 +987,15 @@ void AbstractContinuumMechanicsSolver<DIM>::AllocateMatrixMemory()
         MatSetSizes(mPreconditionMatrix,local_size,local_size,mNumDofs,mNumDofs);
 #endif
 
+#if (PETSC_VERSION_MAJOR == 3 && PETSC_VERSION_MINOR >= 3) //PETSc 3.3 or later
+        if (mUseNodalBlockSize && mCompressibilityType==COMPRESSIBLE)
+        {
+            // The unknowns of each node form a block; AMG preconditioners use this to aggregate them together
+            MatSetBlockSize(mSystemLhsMatrix, DIM);
+            MatSetBlockSize(mPreconditionMatrix, DIM);
+        }
+#endif
+
         if (PetscTools::IsSequential())
         {
             MatSetType(mSystemLhsMatrix, MATSEQAIJ);
@@ -971,4 +1044,29 @@ void AbstractContinuumMechanicsSolver<DIM>::AllocateMatrixMemory()
         delete [] num_non_zeros_each_row;
     }
 }
+
+template<unsigned DIM>
+void AbstractContinuumMechanicsSolver<DIM>::SetUseNodalBlockSize(bool useNodalBlockSize)
+{
+    if (useNodalBlockSize == mUseNodalBlockSize)
+    {
+        return;
+    }
+    mUseNodalBlockSize = useNodalBlockSize;
+
+    // Only compressible matrices are given a block size (see AllocateMatrixMemory())
+    if (mCompressibilityType==COMPRESSIBLE)
+    {
+        PetscTools::Destroy(mResidualVector);
+        PetscTools::Destroy(mLinearSystemRhsVector);
+        PetscTools::Destroy(mSystemLhsMatrix);
+        PetscTools::Destroy(mPreconditionMatrix);
+        if (mDirichletBoundaryConditionsVector)
+        {
+            PetscTools::Destroy(mDirichletBoundaryConditionsVector);
+        }
+
+        AllocateMatrixMemory();
+    }
+}
 #endif // ABSTRACTCONTINUUMMECHANICSSOLVER_HPP_
@@ -315,6 +315,13 @@ protected:
      */
     bool mPetscDirectSolve;
 
+    /**
+     *  Whether to precondition the linear solves with algebraic multigrid (GAMG with rigid
+     *  body near-null-space vectors in the compressible case, HYPRE BoomerAMG in the
+     *  incompressible case) rather than the default ICC/ILU preconditioners.
+     */
+    bool mUseAmgPreconditioner;
+
     /**
      * Whether to call AddActiveStressAndStressDerivative() when computing stresses or not.
      *
@@ -358,6 +365,15 @@ protected:
      */
     virtual void SetKspSolverAndPcType(KSP solver);
 
+    /**
+     * Attach the rigid body modes of the (undeformed) mesh to a matrix as its near-null-space,
+     * for use by smoothed aggregation AMG (GAMG) in the compressible case. Has no effect before
+     * PETSc 3.3.
+     *
+     * @param matrix The matrix the AMG hierarchy will be built from
+     */
+    void SetRigidBodyNearNullSpace(Mat matrix);
+
 
     /**
      * Assemble the residual vector and/or Jacobian matrix (using the current solution stored
@@ -724,6 +740,24 @@ public:
         mPetscDirectSolve = usePetscDirectSolve;
     }
 
+    /**
+     *  Precondition the linear solves with algebraic multigrid instead of ICC (compressible)
+     *  or ILU (incompressible). This is equivalent to the command line argument
+     *  -mech_use_amg. In the compressible case PETSc's GAMG is used, and the rigid body modes
+     *  of the mesh are supplied to it as near-null-space vectors, which is what makes smoothed
+     *  aggregation scale for elasticity. In the incompressible case HYPRE's BoomerAMG is used
+     *  (this requires PETSc to have been built with HYPRE). Further tuning (smoothers, thresholds
+     *  etc.) can be done through the usual PETSc options, eg -pc_gamg_threshold, as
+     *  KSPSetFromOptions() is called after the preconditioner has been chosen.
+     *
+     *  @param useAmgPreconditioner Whether to use an AMG preconditioner or not
+     */
+    void SetUseAmgPreconditioner(bool useAmgPreconditioner = true)
+    {
+        mUseAmgPreconditioner = useAmgPreconditioner;
+        this->SetUseNodalBlockSize(useAmgPreconditioner);
+    }
+
 
     /**
      * This solver is for static problems, however the body force or surface tractions
@@ -832,6 +866,12 @@ AbstractNonlinearElasticitySolver<DIM>::AbstractNonlinearElasticitySolver(Abstra
 
     mTakeFullFirstNewtonStep = CommandLineArguments::Instance()->OptionExists("-mech_full_first_newton_step");
     mPetscDirectSolve = CommandLineArguments::Instance()->OptionExists("-mech_petsc_direct_solve");
+#ifdef MECH_USE_HYPRE
+    mUseAmgPreconditioner = true;
+#else
+    mUseAmgPreconditioner = CommandLineArguments::Instance()->OptionExists("-mech_use_amg");
+#endif
+    this->SetUseNodalBlockSize(mUseAmgPreconditioner);
 }
 
 template<unsigned DIM>
@@ -1565,12 +1605,13 @@ void AbstractNonlinearElasticitySolver<DIM>::Solve(double tol)
 template<unsigned DIM>
 void AbstractNonlinearElasticitySolver<DIM>::SetKspSolverAndPcType(KSP solver)
 {
-    // Four alternatives
+    // Five alternatives
     //   (a) Petsc direct solve
     //   Otherwise iterative solve with:
     //   (b) Incompressible: GMRES with ILU preconditioner (or bjacobi=ILU on each process) [default]. Very poor on large problems.
-    //   (c) Incompressible: GMRES with AMG preconditioner. Uncomment #define MECH_USE_HYPRE above. Requires Petsc3 with HYPRE installed.
-    //   (d) Compressible: CG with ICC
+    //   (c) Incompressible: GMRES with AMG preconditioner. Call SetUseAmgPreconditioner() or uncomment #define MECH_USE_HYPRE above. Requires Petsc3 with HYPRE installed.
+    //   (d) Compressible: CG with ICC [default]
+    //   (e) Compressible: CG with GAMG, using the rigid body modes as near-null-space. Call SetUseAmgPreconditioner(). Requires Petsc 3.3 or later.
 
     PC pc;
     KSPGetPC(solver, &pc);
@@ -1592,6 +1633,15 @@ void AbstractNonlinearElasticitySolver<DIM>::SetKspSolverAndPcType(KSP solver)
         if (this->mCompressibilityType==COMPRESSIBLE)
         {
             KSPSetType(solver,KSPCG);
+#if (PETSC_VERSION_MAJOR == 3 && PETSC_VERSION_MINOR >= 3) //PETSc 3.3 or later
+            if (mUseAmgPreconditioner)
+            {
+                // Smoothed aggregation only scales for elasticity if it is told about the rigid body modes
+                SetRigidBodyNearNullSpace(this->mPreconditionMatrix);
+                PCSetType(pc, PCGAMG);
+            }
+            else
+#endif
             if (PetscTools::IsSequential())
             {
                 PCSetType(pc, PCICC);
@@ -1615,9 +1665,12 @@ void AbstractNonlinearElasticitySolver<DIM>::SetKspSolverAndPcType(KSP solver)
             KSPSetType(solver,KSPGMRES);
             KSPGMRESSetRestart(solver,num_restarts);
 
-            #ifndef MECH_USE_HYPRE
+            if (!mUseAmgPreconditioner)
+            {
                 PCSetType(pc, PCBJACOBI); // BJACOBI = ILU on each block (block = part of matrix on each process)
-            #else
+            }
+            else
+            {
                 /////////////////////////////////////////////////////////////////////////////////////////////////////
                 // Speed up linear solve time massively for larger simulations (in fact GMRES may stagnate without
                 // this for larger problems), by using a AMG preconditioner -- needs HYPRE installed
@@ -1638,11 +1691,54 @@ void AbstractNonlinearElasticitySolver<DIM>::SetKspSolverAndPcType(KSP solver)
                 //PCLDUFactorisationMechanics* p_custom_pc = new PCLDUFactorisationMechanics(solver, this->mPreconditionMatrix, mBlock1Size, mBlock2Size);
                 //remember to delete memory..
                 //KSPSetPreconditionerSide(solver, PC_RIGHT);
-            #endif
+            }
         }
     }
 }
 
+template<unsigned DIM>
+void AbstractNonlinearElasticitySolver<DIM>::SetRigidBodyNearNullSpace(Mat matrix)
+{
+#if (PETSC_VERSION_MAJOR == 3 && PETSC_VERSION_MINOR >= 3) //PETSc 3.3 or later
+    assert(this->mCompressibilityType==COMPRESSIBLE);
+
+    // The coordinates vector has the same parallel layout as the displacement unknowns,
+    // [x_0 y_0 z_0 x_1 y_1 z_1 ...], with block size DIM so that PETSc knows which
+    // entries belong to the same node.
+    PetscInt lo, hi;
+    VecGetOwnershipRange(this->mResidualVector, &lo, &hi);
+
+    Vec coordinates;
+    VecCreate(PETSC_COMM_WORLD, &coordinates);
+    VecSetSizes(coordinates, hi-lo, this->mNumDofs);
+    VecSetBlockSize(coordinates, DIM);
+    VecSetFromOptions(coordinates);
+
+    for (typename AbstractMesh<DIM,DIM>::NodeIterator iter = this->mrQuadMesh.GetNodeIteratorBegin();
+         iter != this->mrQuadMesh.GetNodeIteratorEnd();
+         ++iter)
+    {
+        PetscInt first_dof = DIM*iter->GetIndex();
+        if (first_dof >= lo && first_dof < hi)
+        {
+            const c_vector<double, DIM>& r_location = iter->rGetLocation();
+            for (unsigned j=0; j<DIM; j++)
+            {
+                PetscVecTools::SetElement(coordinates, first_dof + j, r_location(j));
+            }
+        }
+    }
+    PetscVecTools::Finalise(coordinates);
+
+    MatNullSpace near_null_space;
+    MatNullSpaceCreateRigidBody(coordinates, &near_null_space);
+    MatSetNearNullSpace(matrix, near_null_space);
+    MatNullSpaceDestroy(&near_null_space);
+
+    PetscTools::Destroy(coordinates);
+#endif
+}
+
 ////////////////////////////////////////////////////////////////////
 //  The code for the non-SNES solver - maybe remove all this
 //  as SNES solver appears better
@@ -254,12 +254,10 @@ void CompressibleNonlinearElasticitySolver<DIM>::AssembleOnElement(
 
         double wJ = jacobian_determinant * this->mpQuadratureRule->GetWeight(quadrature_index);
 
-        const ChastePoint<DIM>& quadrature_point = this->mpQuadratureRule->rGetQuadPoint(quadrature_index);
-
         // Set up basis function information
-        LinearBasisFunction<DIM>::ComputeBasisFunctions(quadrature_point, linear_phi);
-        QuadraticBasisFunction<DIM>::ComputeBasisFunctions(quadrature_point, quad_phi);
-        QuadraticBasisFunction<DIM>::ComputeTransformedBasisFunctionDerivatives(quadrature_point, inverse_jacobian, grad_quad_phi);
+        linear_phi = this->mpTabulatedBasisFunctions->rGetLinearBasisFunctions(quadrature_index);
+        quad_phi = this->mpTabulatedBasisFunctions->rGetQuadraticBasisFunctions(quadrature_index);
+        this->mpTabulatedBasisFunctions->ComputeTransformedQuadraticBasisFunctionDerivatives(quadrature_index, inverse_jacobian, grad_quad_phi);
         trans_grad_quad_phi = trans(grad_quad_phi);
 
         // Get the body force, interpolating X if necessary
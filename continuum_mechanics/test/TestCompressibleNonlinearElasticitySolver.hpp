@@ -941,6 +941,121 @@ public:
         }
     }
 
+    void TestSolveWithAmgPreconditioner()
+    {
+        QuadraticMesh<3> mesh(0.25, 1.0, 1.0, 1.0);
+        CompressibleMooneyRivlinMaterialLaw<3> law(1.0,1.0);
+
+        // fix the X=0 face
+        std::vector<unsigned> fixed_nodes = NonlinearElasticityTools<3>::GetNodesByComponentValue(mesh, 0, 0.0);
+
+        SolidMechanicsProblemDefinition<3> problem_defn(mesh);
+        problem_defn.SetMaterialLaw(COMPRESSIBLE,&law);
+        problem_defn.SetZeroDisplacementNodes(fixed_nodes);
+
+        c_vector<double,3> gravity;
+        gravity(0) = 0.0;
+        gravity(1) = -0.5;
+        gravity(2) = 0.0;
+        problem_defn.SetBodyForce(gravity);
+
+        CompressibleNonlinearElasticitySolver<3> default_solver(mesh,
+                                                                problem_defn,
+                                                                "CompressibleMechanicsDefaultPc");
+        default_solver.Solve();
+
+        // Same problem, preconditioned with GAMG and the rigid body modes as near-null-space
+        CompressibleNonlinearElasticitySolver<3> amg_solver(mesh,
+                                                            problem_defn,
+                                                            "CompressibleMechanicsAmgPc");
+        amg_solver.SetUseAmgPreconditioner();
+        amg_solver.Solve();
+
+#if (PETSC_VERSION_MAJOR == 3 && PETSC_VERSION_MINOR >= 3) //PETSc 3.3 or later
+        // Only the AMG solver groups the unknowns of each node into a block
+        PetscInt block_size;
+        MatGetBlockSize(default_solver.mSystemLhsMatrix, &block_size);
+        TS_ASSERT_EQUALS(block_size, 1);
+        MatGetBlockSize(amg_solver.mSystemLhsMatrix, &block_size);
+        TS_ASSERT_EQUALS(block_size, 3);
+        MatGetBlockSize(amg_solver.mPreconditionMatrix, &block_size);
+        TS_ASSERT_EQUALS(block_size, 3);
+#endif
+
+        std::vector<c_vector<double,3> >& r_default_solution = default_solver.rGetDeformedPosition();
+        std::vector<c_vector<double,3> >& r_amg_solution = amg_solver.rGetDeformedPosition();
+        for (unsigned i=0; i<mesh.GetNumNodes(); i++)
+        {
+            for (unsigned j=0; j<3; j++)
+            {
+                TS_ASSERT_DELTA(r_amg_solution[i](j), r_default_solution[i](j), 1e-5);
+            }
+
+            // The free end has sagged under gravity
+            if (fabs(mesh.GetNode(i)->rGetLocation()[0] - 1.0) < 1e-6)
+            {
+                TS_ASSERT_LESS_THAN(r_amg_solution[i](1), mesh.GetNode(i)->rGetLocation()[1]);
+            }
+        }
+    }
+
+    void TestSolveWithAmgPreconditioner2d()
+    {
+        QuadraticMesh<2> mesh(0.1, 1.0, 1.0);
+        CompressibleMooneyRivlinMaterialLaw<2> law(1.0,1.0);
+
+        // fix the X=0 edge
+        std::vector<unsigned> fixed_nodes = NonlinearElasticityTools<2>::GetNodesByComponentValue(mesh, 0, 0.0);
+
+        SolidMechanicsProblemDefinition<2> problem_defn(mesh);
+        problem_defn.SetMaterialLaw(COMPRESSIBLE,&law);
+        problem_defn.SetZeroDisplacementNodes(fixed_nodes);
+
+        c_vector<double,2> gravity;
+        gravity(0) = 0.0;
+        gravity(1) = -0.5;
+        problem_defn.SetBodyForce(gravity);
+
+        CompressibleNonlinearElasticitySolver<2> default_solver(mesh,
+                                                                problem_defn,
+                                                                "CompressibleMechanicsDefaultPc2d");
+        default_solver.Solve();
+
+        // Same problem, preconditioned with GAMG and the rigid body modes as near-null-space
+        CompressibleNonlinearElasticitySolver<2> amg_solver(mesh,
+                                                            problem_defn,
+                                                            "CompressibleMechanicsAmgPc2d");
+        amg_solver.SetUseAmgPreconditioner();
+        amg_solver.Solve();
+
+#if (PETSC_VERSION_MAJOR == 3 && PETSC_VERSION_MINOR >= 3) //PETSc 3.3 or later
+        // In 2D too, only the AMG solver groups the unknowns of each node into a block
+        PetscInt block_size;
+        MatGetBlockSize(default_solver.mSystemLhsMatrix, &block_size);
+        TS_ASSERT_EQUALS(block_size, 1);
+        MatGetBlockSize(amg_solver.mSystemLhsMatrix, &block_size);
+        TS_ASSERT_EQUALS(block_size, 2);
+        MatGetBlockSize(amg_solver.mPreconditionMatrix, &block_size);
+        TS_ASSERT_EQUALS(block_size, 2);
+#endif
+
+        std::vector<c_vector<double,2> >& r_default_solution = default_solver.rGetDeformedPosition();
+        std::vector<c_vector<double,2> >& r_amg_solution = amg_solver.rGetDeformedPosition();
+        for (unsigned i=0; i<mesh.GetNumNodes(); i++)
+        {
+            for (unsigned j=0; j<2; j++)
+            {
+                TS_ASSERT_DELTA(r_amg_solution[i](j), r_default_solution[i](j), 1e-5);
+            }
+
+            // The free end has sagged under gravity
+            if (fabs(mesh.GetNode(i)->rGetLocation()[0] - 1.0) < 1e-6)
+            {
+                TS_ASSERT_LESS_THAN(r_amg_solution[i](1), mesh.GetNode(i)->rGetLocation()[1]);
+            }
+        }
+    }
+
     /* HOW_TO_TAG Continuum mechanics
      * Write strain after solve
      */
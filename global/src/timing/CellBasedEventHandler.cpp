@@ -33,8 +33,32 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 */
 
+#include <cassert>
+
 #include "CellBasedEventHandler.hpp"
 
 const char* CellBasedEventHandler::EventName[] = { "Setup", "Death", "Birth",
                                                 "Update_Pop", "Update_Sim", "Tessellate", "Force",
                                                 "Position", "Output", "Pde", "Total" };
+
+unsigned long CellBasedEventHandler::mCounters[] = { 0, 0, 0 };
+
+void CellBasedEventHandler::IncrementCounter(unsigned counter)
+{
+    assert(counter < 3);
+    mCounters[counter]++;
+}
+
+unsigned long CellBasedEventHandler::GetCounter(unsigned counter)
+{
+    assert(counter < 3);
+    return mCounters[counter];
+}
+
+void CellBasedEventHandler::ResetCounters()
+{
+    for (unsigned i=0; i<3; i++)
+    {
+        mCounters[i] = 0;
+    }
+}
@@ -63,6 +63,42 @@ public:
         PDE,
         EVERYTHING
     } CellBasedEventType;
+
+    /**
+     * Definition of cell_based counter types, which record the allocations made by
+     * classes that recycle their memory (such as Cell and CellData).
+     */
+    typedef enum
+    {
+        HEAP_ALLOCATIONS=0,
+        RECYCLED_ALLOCATIONS,
+        DEALLOCATIONS
+    } CellBasedCounterType;
+
+    /**
+     * Increment a counter.
+     *
+     * @param counter the counter to increment
+     */
+    static void IncrementCounter(unsigned counter);
+
+    /**
+     * @return the current value of a counter. Differencing values taken at the start
+     * and end of a time step gives the number of allocations made during that step.
+     *
+     * @param counter the counter
+     */
+    static unsigned long GetCounter(unsigned counter);
+
+    /**
+     * Reset all counters to zero.
+     */
+    static void ResetCounters();
+
+private:
+
+    /** The current values of the counters. */
+    static unsigned long mCounters[3];
 };
 
 #endif /*CELLBASEDEVENTHANDLER_HPP_*/
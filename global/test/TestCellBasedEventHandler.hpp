@@ -35,11 +35,13 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #ifndef TESTCELLBASEDEVENTHANDLER_HPP_
 #define TESTCELLBASEDEVENTHANDLER_HPP_
 
+#include <string>
+
 #include "PetscSetupAndFinalize.hpp"
 #include "CellBasedEventHandler.hpp"
 
 /**
- * This class consists of a single test for the CellBasedEventHandler
+ * This class consists of tests for the CellBasedEventHandler
  * class.
  */
 class TestCellBasedEventHandler : public CxxTest::TestSuite
@@ -92,6 +94,25 @@ public:
 
         CellBasedEventHandler::Report();
     }
+
+    void TestCounters()
+    {
+        CellBasedEventHandler::ResetCounters();
+        for (unsigned i=0; i<3; i++)
+        {
+            TS_ASSERT_EQUALS(CellBasedEventHandler::GetCounter(i), 0u);
+        }
+
+        CellBasedEventHandler::IncrementCounter(CellBasedEventHandler::HEAP_ALLOCATIONS);
+        CellBasedEventHandler::IncrementCounter(CellBasedEventHandler::RECYCLED_ALLOCATIONS);
+        CellBasedEventHandler::IncrementCounter(CellBasedEventHandler::RECYCLED_ALLOCATIONS);
+        TS_ASSERT_EQUALS(CellBasedEventHandler::GetCounter(CellBasedEventHandler::HEAP_ALLOCATIONS), 1u);
+        TS_ASSERT_EQUALS(CellBasedEventHandler::GetCounter(CellBasedEventHandler::RECYCLED_ALLOCATIONS), 2u);
+        TS_ASSERT_EQUALS(CellBasedEventHandler::GetCounter(CellBasedEventHandler::DEALLOCATIONS), 0u);
+
+        CellBasedEventHandler::ResetCounters();
+        TS_ASSERT_EQUALS(CellBasedEventHandler::GetCounter(CellBasedEventHandler::RECYCLED_ALLOCATIONS), 0u);
+    }
 };
 
 #endif /*TESTCELLBASEDEVENTHANDLER_HPP_*/
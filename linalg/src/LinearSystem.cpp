@@ -65,6 +65,7 @@ LinearSystem::LinearSystem(PetscInt lhsVectorSize, unsigned rowPreallocation)
     mpBlockDiagonalPC(nullptr),
     mpLDUFactorisationPC(nullptr),
     mpTwoLevelsBlockDiagonalPC(nullptr),
+    mpSinglePrecisionIluPC(nullptr),
     mpBathNodes( boost::shared_ptr<std::vector<PetscInt> >() ),
     mPrecondMatrixIsNotLhs(false),
     mRowPreallocation(rowPreallocation),
@@ -73,7 +74,12 @@ LinearSystem::LinearSystem(PetscInt lhsVectorSize, unsigned rowPreallocation)
     mpConvergenceTestContext(nullptr),
     mEigMin(DBL_MAX),
     mEigMax(DBL_MIN),
-    mForceSpectrumReevaluation(false)
+    mForceSpectrumReevaluation(false),
+    mReusePreconditionerForNSolves(0),
+    mRebuildPreconditionerAboveNumIterations(UINT_MAX),
+    mPreconditionerRebuildRequested(false),
+    mNumSolvesWithCurrentPreconditioner(0),
+    mNumPreconditionerSetUps(0)
 {
     assert(lhsVectorSize > 0);
     if (mRowPreallocation == UINT_MAX)
@@ -120,6 +126,7 @@ LinearSystem::LinearSystem(PetscInt lhsVectorSize, Mat lhsMatrix, Vec rhsVector)
     mpBlockDiagonalPC(nullptr),
     mpLDUFactorisationPC(nullptr),
     mpTwoLevelsBlockDiagonalPC(nullptr),
+    mpSinglePrecisionIluPC(nullptr),
     mpBathNodes( boost::shared_ptr<std::vector<PetscInt> >() ),
     mPrecondMatrixIsNotLhs(false),
     mUseFixedNumberIterations(false),
@@ -127,7 +134,12 @@ LinearSystem::LinearSystem(PetscInt lhsVectorSize, Mat lhsMatrix, Vec rhsVector)
     mpConvergenceTestContext(nullptr),
     mEigMin(DBL_MAX),
     mEigMax(DBL_MIN),
-    mForceSpectrumReevaluation(false)
+    mForceSpectrumReevaluation(false),
+    mReusePreconditionerForNSolves(0),
+    mRebuildPreconditionerAboveNumIterations(UINT_MAX),
+    mPreconditionerRebuildRequested(false),
+    mNumSolvesWithCurrentPreconditioner(0),
+    mNumPreconditionerSetUps(0)
 {
     assert(lhsVectorSize > 0);
     // Conveniently, PETSc Mats and Vecs are actually pointers
@@ -155,6 +167,7 @@ LinearSystem::LinearSystem(Vec templateVector, unsigned rowPreallocation, bool n
     mpBlockDiagonalPC(nullptr),
     mpLDUFactorisationPC(nullptr),
     mpTwoLevelsBlockDiagonalPC(nullptr),
+    mpSinglePrecisionIluPC(nullptr),
     mpBathNodes( boost::shared_ptr<std::vector<PetscInt> >() ),
     mPrecondMatrixIsNotLhs(false),
     mRowPreallocation(rowPreallocation),
@@ -163,7 +176,12 @@ LinearSystem::LinearSystem(Vec templateVector, unsigned rowPreallocation, bool n
     mpConvergenceTestContext(nullptr),
     mEigMin(DBL_MAX),
     mEigMax(DBL_MIN),
-    mForceSpectrumReevaluation(false)
+    mForceSpectrumReevaluation(false),
+    mReusePreconditionerForNSolves(0),
+    mRebuildPreconditionerAboveNumIterations(UINT_MAX),
+    mPreconditionerRebuildRequested(false),
+    mNumSolvesWithCurrentPreconditioner(0),
+    mNumPreconditionerSetUps(0)
 {
     VecDuplicate(templateVector, &mRhsVector);
     VecGetSize(mRhsVector, &mSize);
@@ -196,6 +214,7 @@ LinearSystem::LinearSystem(Vec residualVector, Mat jacobianMatrix)
     mpBlockDiagonalPC(nullptr),
     mpLDUFactorisationPC(nullptr),
     mpTwoLevelsBlockDiagonalPC(nullptr),
+    mpSinglePrecisionIluPC(nullptr),
     mpBathNodes( boost::shared_ptr<std::vector<PetscInt> >() ),
     mPrecondMatrixIsNotLhs(false),
     mRowPreallocation(UINT_MAX),
@@ -204,7 +223,12 @@ LinearSystem::LinearSystem(Vec residualVector, Mat jacobianMatrix)
     mpConvergenceTestContext(nullptr),
     mEigMin(DBL_MAX),
     mEigMax(DBL_MIN),
-    mForceSpectrumReevaluation(false)
+    mForceSpectrumReevaluation(false),
+    mReusePreconditionerForNSolves(0),
+    mRebuildPreconditionerAboveNumIterations(UINT_MAX),
+    mPreconditionerRebuildRequested(false),
+    mNumSolvesWithCurrentPreconditioner(0),
+    mNumPreconditionerSetUps(0)
 {
     assert(residualVector || jacobianMatrix);
     mRhsVector = residualVector;
@@ -253,6 +277,7 @@ LinearSystem::~LinearSystem()
     delete mpBlockDiagonalPC;
     delete mpLDUFactorisationPC;
     delete mpTwoLevelsBlockDiagonalPC;
+    delete mpSinglePrecisionIluPC;
 
     if (mDestroyMatAndVec)
     {
@@ -628,6 +653,8 @@ void LinearSystem::SetPcType(const char* pcType, boost::shared_ptr<std::vector<P
             mpLDUFactorisationPC = nullptr;
             delete mpTwoLevelsBlockDiagonalPC;
             mpTwoLevelsBlockDiagonalPC = nullptr;
+            delete mpSinglePrecisionIluPC;
+            mpSinglePrecisionIluPC = nullptr;
 
             mpBlockDiagonalPC = new PCBlockDiagonal(mKspSolver);
         }
@@ -641,6 +668,8 @@ void LinearSystem::SetPcType(const char* pcType, boost::shared_ptr<std::vector<P
             mpLDUFactorisationPC = nullptr;
             delete mpTwoLevelsBlockDiagonalPC;
             mpTwoLevelsBlockDiagonalPC = nullptr;
+            delete mpSinglePrecisionIluPC;
+            mpSinglePrecisionIluPC = nullptr;
 
             mpLDUFactorisationPC = new PCLDUFactorisation(mKspSolver);
         }
@@ -654,6 +683,8 @@ void LinearSystem::SetPcType(const char* pcType, boost::shared_ptr<std::vector<P
             mpLDUFactorisationPC = nullptr;
             delete mpTwoLevelsBlockDiagonalPC;
             mpTwoLevelsBlockDiagonalPC = nullptr;
+            delete mpSinglePrecisionIluPC;
+            mpSinglePrecisionIluPC = nullptr;
 
             if (!mpBathNodes)
             {
@@ -661,6 +692,21 @@ void LinearSystem::SetPcType(const char* pcType, boost::shared_ptr<std::vector<P
             }
             mpTwoLevelsBlockDiagonalPC = new PCTwoLevelsBlockDiagonal(mKspSolver, *mpBathNodes);
         }
+        else if (mPcType == "singleprecisionilu")
+        {
+            // If the previous preconditioner was purpose-built we need to free the appropriate pointer.
+            /// \todo: #1082 use a single pointer to abstract class
+            delete mpBlockDiagonalPC;
+            mpBlockDiagonalPC = nullptr;
+            delete mpLDUFactorisationPC;
+            mpLDUFactorisationPC = nullptr;
+            delete mpTwoLevelsBlockDiagonalPC;
+            mpTwoLevelsBlockDiagonalPC = nullptr;
+            delete mpSinglePrecisionIluPC;
+            mpSinglePrecisionIluPC = nullptr;
+
+            mpSinglePrecisionIluPC = new PCSinglePrecisionIlu(mKspSolver);
+        }
         else
         {
             PC prec;
@@ -822,6 +868,11 @@ Vec LinearSystem::Solve(Vec lhsGuess)
 #endif
 
             }
+            else if (mPcType == "singleprecisionilu")
+            {
+                // The factorisation is computed by KSPSetUp() below
+                mpSinglePrecisionIluPC = new PCSinglePrecisionIlu(mKspSolver);
+            }
             else
             {
                 PCSetType(prec, mPcType.c_str());
@@ -949,6 +1000,9 @@ Vec LinearSystem::Solve(Vec lhsGuess)
 #endif
 
         mKspIsSetup = true;
+        mNumSolvesWithCurrentPreconditioner = 0;
+        mNumPreconditionerSetUps++;
+        mPreconditionerRebuildRequested = false;
 
         HeartEventHandler::EndEvent(HeartEventHandler::COMMUNICATION);
     }
@@ -959,6 +1013,33 @@ Vec LinearSystem::Solve(Vec lhsGuess)
             WARNING("LinearSystem doesn't like the non-zero pattern of a matrix to change. (I think you changed it).");
             mNonZerosUsed = mat_info.nz_used;
         }
+
+#if (PETSC_VERSION_MAJOR==3 && PETSC_VERSION_MINOR >= 5) //PETSc 3.5 or later
+        if (!mMatrixIsConstant && mReusePreconditionerForNSolves > 0)
+        {
+            bool rebuild = mPreconditionerRebuildRequested
+                           || mNumSolvesWithCurrentPreconditioner >= mReusePreconditionerForNSolves
+                           || GetNumIterations() > mRebuildPreconditionerAboveNumIterations;
+
+            KSPSetReusePreconditioner(mKspSolver, rebuild ? PETSC_FALSE : PETSC_TRUE);
+            if (rebuild)
+            {
+                /*
+                 * Form the new preconditioner now, so that this is timed separately from the solve.
+                 * It is timed under COMMUNICATION, as the initial KSP and preconditioner set-up
+                 * above is, so that set-up costs are reported together. HeartEventHandler has no
+                 * set-up event, and adding one would change the columns of every timing report.
+                 */
+                HeartEventHandler::BeginEvent(HeartEventHandler::COMMUNICATION);
+                KSPSetUp(mKspSolver);
+                HeartEventHandler::EndEvent(HeartEventHandler::COMMUNICATION);
+
+                mNumSolvesWithCurrentPreconditioner = 0;
+                mNumPreconditionerSetUps++;
+                mPreconditionerRebuildRequested = false;
+            }
+        }
+#endif
 //        PetscScalar norm;
 //        MatNorm(mLhsMatrix, NORM_FROBENIUS, &norm);
 //        if (fabs(norm - mMatrixNorm) > 0)
@@ -1202,6 +1283,7 @@ Vec LinearSystem::Solve(Vec lhsGuess)
         }
 
         mNumSolves++;
+        mNumSolvesWithCurrentPreconditioner++;
 
     }
     catch (const Exception& e)
@@ -1246,6 +1328,29 @@ void LinearSystem::SetUseFixedNumberIterations(bool useFixedNumberIterations, un
     mEvaluateNumItsEveryNSolves = evaluateNumItsEveryNSolves;
 }
 
+void LinearSystem::SetPreconditionerReuse(unsigned numSolves, unsigned maxNumIterations)
+{
+    mReusePreconditionerForNSolves = numSolves;
+    mRebuildPreconditionerAboveNumIterations = maxNumIterations;
+#if (PETSC_VERSION_MAJOR==3 && PETSC_VERSION_MINOR >= 5) //PETSc 3.5 or later
+    if (mKspIsSetup && numSolves == 0 && !mMatrixIsConstant)
+    {
+        // Go back to rebuilding the preconditioner whenever the matrix changes
+        KSPSetReusePreconditioner(mKspSolver, PETSC_FALSE);
+    }
+#endif
+}
+
+void LinearSystem::RequestPreconditionerRebuild()
+{
+    mPreconditionerRebuildRequested = true;
+}
+
+unsigned LinearSystem::GetNumPreconditionerSetUps() const
+{
+    return mNumPreconditionerSetUps;
+}
+
 void LinearSystem::ResetKspSolver()
 {
     if (mKspIsSetup)
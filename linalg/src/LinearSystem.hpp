@@ -46,6 +46,7 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "PCBlockDiagonal.hpp"
 #include "PCLDUFactorisation.hpp"
 #include "PCTwoLevelsBlockDiagonal.hpp"
+#include "PCSinglePrecisionIlu.hpp"
 #include "ArchiveLocationInfo.hpp"
 //#include <boost/serialization/shared_ptr.hpp>
 
@@ -68,6 +69,7 @@ class LinearSystem
     friend class TestPCBlockDiagonal;
     friend class TestPCTwoLevelsBlockDiagonal;
     friend class TestPCLDUFactorisation;
+    friend class TestPCSinglePrecisionIlu;
     friend class TestChebyshevIteration;
 
 private:
@@ -111,6 +113,8 @@ private:
     PCLDUFactorisation* mpLDUFactorisationPC;
     /** Stores a pointer to a purpose-build preconditioner*/
     PCTwoLevelsBlockDiagonal* mpTwoLevelsBlockDiagonalPC;
+    /** Stores a pointer to a purpose-build preconditioner*/
+    PCSinglePrecisionIlu* mpSinglePrecisionIluPC;
 
     /** Pointer to vector containing a list of bath nodes*/
     boost::shared_ptr<std::vector<PetscInt> > mpBathNodes;
@@ -146,6 +150,25 @@ private:
     /** Under certain circunstances you have to reevaluate the spectrum before the k*n-th, k=0,1,..., iteration*/
     bool mForceSpectrumReevaluation;
 
+    /**
+     * When the matrix is not constant, the maximum number of solves for which a preconditioner
+     * is reused before being rebuilt. Zero (the default) means the preconditioner is rebuilt
+     * whenever the matrix has changed. See SetPreconditionerReuse().
+     */
+    unsigned mReusePreconditionerForNSolves;
+
+    /** A reused preconditioner is rebuilt early if the last solve took more than this many iterations. */
+    unsigned mRebuildPreconditionerAboveNumIterations;
+
+    /** Whether to rebuild the preconditioner at the next solve. See RequestPreconditionerRebuild(). */
+    bool mPreconditionerRebuildRequested;
+
+    /** The number of solves done with the current preconditioner (when reusing preconditioners). */
+    unsigned mNumSolvesWithCurrentPreconditioner;
+
+    /** The number of times the preconditioner has been explicitly set up. See GetNumPreconditionerSetUps(). */
+    unsigned mNumPreconditionerSetUps;
+
 #ifdef TRACE_KSP
     unsigned mTotalNumIterations;
     unsigned mMaxNumIterations;
@@ -333,6 +356,10 @@ public:
 
     /**
      * Set the preconditioner type  (see PETSc PCSetType() for valid arguments).
+     * In addition to the PETSc types, the purpose-built preconditioners "blockdiagonal",
+     * "ldufactorisation", "twolevelsblockdiagonal" and "singleprecisionilu" (block Jacobi
+     * ILU(0) with factors stored and applied in single precision, see PCSinglePrecisionIlu)
+     * are available.
      *
      * @param pcType the preconditioner type
      * @param pBathNodes the list of nodes defining the bath
@@ -570,6 +597,40 @@ public:
      */
     void SetUseFixedNumberIterations(bool useFixedNumberIterations = true, unsigned evaluateNumItsEveryNSolves = UINT_MAX);
 
+    /**
+     * Set a policy for reusing the preconditioner when the matrix is not constant (see
+     * SetMatrixIsConstant()). By default the preconditioner is rebuilt at every solve in which
+     * the matrix has changed. If the matrix only drifts slightly between solves (e.g. over
+     * time steps or Newton iterations) it is often cheaper to keep using an out-of-date
+     * preconditioner, at the cost of a few extra iterations.
+     *
+     * The preconditioner is then rebuilt after it has been used for numSolves solves, or
+     * earlier if the previous solve took more than maxNumIterations iterations, or if
+     * RequestPreconditionerRebuild() has been called. Rebuilding is done in a separate
+     * KSPSetUp() call before the solve, so its cost is timed under
+     * HeartEventHandler::COMMUNICATION (like the initial set up) rather than
+     * HeartEventHandler::SOLVE_LINEAR_SYSTEM.
+     *
+     *  ** Only has an effect with PETSc 3.5 or later (uses KSPSetReusePreconditioner()) **
+     *
+     * @param numSolves the maximum number of solves to reuse a preconditioner for (0 to turn reuse off)
+     * @param maxNumIterations rebuild the preconditioner if a solve takes more than this many iterations
+     */
+    void SetPreconditionerReuse(unsigned numSolves, unsigned maxNumIterations=UINT_MAX);
+
+    /**
+     * Ensure the preconditioner is rebuilt at the next solve, when reusing preconditioners
+     * (see SetPreconditionerReuse()). For example, call this after a large change to the matrix.
+     */
+    void RequestPreconditionerRebuild();
+
+    /**
+     * @return the number of times the preconditioner has been explicitly set up: once when
+     * the KSP solver is created, plus each rebuild under the policy set by SetPreconditionerReuse().
+     * (Rebuilds done implicitly by PETSc when preconditioners are not being reused are not counted.)
+     */
+    unsigned GetNumPreconditionerSetUps() const;
+
     /**
      * Method to regenerate all KSP objects, including the solver and the preconditioner (e.g. after
      * changing the PDE time step when using time adaptivity).
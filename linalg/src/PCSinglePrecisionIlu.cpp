@@ -0,0 +1,254 @@
+/*
+
+Copyright (c) 2005-2017, University of Oxford.
+All rights reserved.
+
+University of Oxford means the Chancellor, Masters and Scholars of the
+University of Oxford, having an administrative office at Wellington
+Square, Oxford OX1 2JD, UK.
+
+This file is part of Chaste.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+ * Redistributions of source code must retain the above copyright notice,
+   this list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+ * Neither the name of the University of Oxford nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include <algorithm>
+
+#include "PCSinglePrecisionIlu.hpp"
+#include "Warnings.hpp"
+
+PCSinglePrecisionIlu::PCSinglePrecisionIlu(KSP& rKspObject)
+{
+    KSPGetPC(rKspObject, &mPetscPCObject);
+
+    mPCContext.pcObject = mPetscPCObject;
+    mPCContext.numLocalRows = 0;
+
+    PCSetType(mPetscPCObject, PCSHELL);
+
+    // Register PC context so it gets passed to PCSinglePrecisionIluApply and PCSinglePrecisionIluSetUp
+    PCShellSetContext(mPetscPCObject, &mPCContext);
+
+    // Register call-back functions
+    PCShellSetApply(mPetscPCObject, PCSinglePrecisionIluApply);
+    PCShellSetSetUp(mPetscPCObject, PCSinglePrecisionIluSetUp);
+}
+
+unsigned long PCSinglePrecisionIlu::GetFactorStorageBytes() const
+{
+    return mPCContext.factorValues.size()*sizeof(float) + mPCContext.columnIndices.size()*sizeof(PetscInt);
+}
+
+#if (PETSC_VERSION_MAJOR == 3 && PETSC_VERSION_MINOR >= 1) //PETSc 3.1 or later
+PetscErrorCode PCSinglePrecisionIluSetUp(PC pc_object)
+{
+  void* pc_context;
+
+  PCShellGetContext(pc_object, &pc_context);
+#else
+PetscErrorCode PCSinglePrecisionIluSetUp(void* pc_context)
+{
+#endif
+
+    // Cast the context pointer to PCSinglePrecisionIluContext
+    PCSinglePrecisionIlu::PCSinglePrecisionIluContext* p_context = (PCSinglePrecisionIlu::PCSinglePrecisionIluContext*) pc_context;
+    assert(p_context!=nullptr);
+
+    Mat system_matrix, precond_matrix;
+#if (PETSC_VERSION_MAJOR==3 && PETSC_VERSION_MINOR>=5)
+    PCGetOperators(p_context->pcObject, &system_matrix, &precond_matrix);
+#else
+    MatStructure flag;
+    PCGetOperators(p_context->pcObject, &system_matrix, &precond_matrix, &flag);
+#endif
+
+    PetscInt lo, hi;
+    MatGetOwnershipRange(precond_matrix, &lo, &hi);
+    PetscInt num_rows = hi - lo;
+
+    std::vector<PetscInt>& r_row_starts = p_context->rowStarts;
+    std::vector<PetscInt>& r_columns = p_context->columnIndices;
+    std::vector<PetscInt>& r_diagonal = p_context->diagonalPositions;
+    r_row_starts.assign(1, 0);
+    r_columns.clear();
+    r_diagonal.clear();
+
+    // Copy the block of the matrix owned by this process, keeping a double precision copy of the
+    // values for the factorisation
+    std::vector<double> values;
+    for (PetscInt row=lo; row<hi; row++)
+    {
+        PetscInt num_entries;
+        const PetscInt* p_columns;
+        const PetscScalar* p_values;
+        MatGetRow(precond_matrix, row, &num_entries, &p_columns, &p_values);
+
+        PetscInt row_start = r_columns.size();
+        PetscInt diagonal_position = -1;
+        for (PetscInt k=0; k<num_entries; k++)
+        {
+            if (p_columns[k] >= lo && p_columns[k] < hi)
+            {
+                if (p_columns[k] == row)
+                {
+                    diagonal_position = r_columns.size();
+                }
+                r_columns.push_back(p_columns[k] - lo);
+                values.push_back(p_values[k]);
+            }
+        }
+        MatRestoreRow(precond_matrix, row, &num_entries, &p_columns, &p_values);
+
+        if (diagonal_position < 0)
+        {
+            // The diagonal entry is not stored: insert an explicit zero (which becomes a zero pivot)
+            std::vector<PetscInt>::iterator it = std::lower_bound(r_columns.begin()+row_start, r_columns.end(), row-lo);
+            diagonal_position = it - r_columns.begin();
+            r_columns.insert(it, row-lo);
+            values.insert(values.begin()+diagonal_position, 0.0);
+        }
+
+        r_diagonal.push_back(diagonal_position);
+        r_row_starts.push_back(r_columns.size());
+    }
+
+    // ILU(0) factorisation (IKJ variant) on the sparsity pattern of the block
+    std::vector<PetscInt> position_in_row(num_rows, -1);
+    unsigned num_zero_pivots = 0;
+    for (PetscInt i=0; i<num_rows; i++)
+    {
+        for (PetscInt p=r_row_starts[i]; p<r_row_starts[i+1]; p++)
+        {
+            position_in_row[r_columns[p]] = p;
+        }
+
+        for (PetscInt p=r_row_starts[i]; p<r_diagonal[i]; p++)
+        {
+            PetscInt k = r_columns[p];
+            values[p] /= values[r_diagonal[k]];
+            for (PetscInt q=r_diagonal[k]+1; q<r_row_starts[k+1]; q++)
+            {
+                PetscInt position = position_in_row[r_columns[q]];
+                if (position >= 0)
+                {
+                    values[position] -= values[p]*values[q];
+                }
+            }
+        }
+
+        if (values[r_diagonal[i]] == 0.0)
+        {
+            // Replace the pivot so that the factorisation can continue; the preconditioner is then
+            // no longer an incomplete factorisation of the matrix, so the user is warned below
+            values[r_diagonal[i]] = 1.0;
+            num_zero_pivots++;
+        }
+
+        for (PetscInt p=r_row_starts[i]; p<r_row_starts[i+1]; p++)
+        {
+            position_in_row[r_columns[p]] = -1;
+        }
+    }
+
+    if (num_zero_pivots > 0)
+    {
+        WARNING("Single precision ILU(0) met " << num_zero_pivots << " zero pivot(s) on process "
+                << PetscTools::GetMyRank() << ", which have been replaced by one");
+    }
+
+    // Round the factors to single precision, storing the reciprocal of the diagonal of U
+    p_context->factorValues.resize(values.size());
+    for (unsigned p=0; p<values.size(); p++)
+    {
+        p_context->factorValues[p] = values[p];
+    }
+    for (PetscInt i=0; i<num_rows; i++)
+    {
+        p_context->factorValues[r_diagonal[i]] = 1.0/values[r_diagonal[i]];
+    }
+
+    p_context->work.resize(num_rows);
+    p_context->numLocalRows = num_rows;
+
+    return 0;
+}
+
+#if (PETSC_VERSION_MAJOR == 3 && PETSC_VERSION_MINOR >= 1) //PETSc 3.1 or later
+PetscErrorCode PCSinglePrecisionIluApply(PC pc_object, Vec x, Vec y)
+{
+  void* pc_context;
+
+  PCShellGetContext(pc_object, &pc_context);
+#else
+PetscErrorCode PCSinglePrecisionIluApply(void* pc_context, Vec x, Vec y)
+{
+#endif
+
+    // Cast the context pointer to PCSinglePrecisionIluContext
+    PCSinglePrecisionIlu::PCSinglePrecisionIluContext* p_context = (PCSinglePrecisionIlu::PCSinglePrecisionIluContext*) pc_context;
+    assert(p_context!=nullptr);
+
+    const std::vector<PetscInt>& r_row_starts = p_context->rowStarts;
+    const std::vector<PetscInt>& r_columns = p_context->columnIndices;
+    const std::vector<PetscInt>& r_diagonal = p_context->diagonalPositions;
+    const std::vector<float>& r_factors = p_context->factorValues;
+    std::vector<float>& r_work = p_context->work;
+
+    const PetscScalar* p_x;
+    PetscScalar* p_y;
+    VecGetArrayRead(x, &p_x);
+    VecGetArray(y, &p_y);
+
+    /*
+     * Solve L*w = x (L has unit diagonal)
+     */
+    for (PetscInt i=0; i<p_context->numLocalRows; i++)
+    {
+        float sum = p_x[i];
+        for (PetscInt p=r_row_starts[i]; p<r_diagonal[i]; p++)
+        {
+            sum -= r_factors[p]*r_work[r_columns[p]];
+        }
+        r_work[i] = sum;
+    }
+
+    /*
+     * Solve U*y = w
+     */
+    for (PetscInt i=p_context->numLocalRows-1; i>=0; i--)
+    {
+        float sum = r_work[i];
+        for (PetscInt p=r_diagonal[i]+1; p<r_row_starts[i+1]; p++)
+        {
+            sum -= r_factors[p]*r_work[r_columns[p]];
+        }
+        r_work[i] = sum*r_factors[r_diagonal[i]];
+        p_y[i] = r_work[i];
+    }
+
+    VecRestoreArrayRead(x, &p_x);
+    VecRestoreArray(y, &p_y);
+
+    return 0;
+}
@@ -0,0 +1,125 @@
+/*
+
+Copyright (c) 2005-2017, University of Oxford.
+All rights reserved.
+
+University of Oxford means the Chancellor, Masters and Scholars of the
+University of Oxford, having an administrative office at Wellington
+Square, Oxford OX1 2JD, UK.
+
+This file is part of Chaste.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+ * Redistributions of source code must retain the above copyright notice,
+   this list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+ * Neither the name of the University of Oxford nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#ifndef PCSINGLEPRECISIONILU_HPP_
+#define PCSINGLEPRECISIONILU_HPP_
+
+#include <cassert>
+#include <vector>
+#include <petscvec.h>
+#include <petscmat.h>
+#include <petscksp.h>
+#include <petscpc.h>
+#include "PetscTools.hpp"
+
+/**
+ * PETSc will return the control to this function everytime it needs to precondition a vector (i.e. y = inv(M)*x)
+ *
+ * @param pc_object the PETSc preconditioner object (its shell context is a PCSinglePrecisionIluContext)
+ * @param x unpreconditioned residual.
+ * @param y preconditioned residual. y = inv(M)*x
+ */
+#if (PETSC_VERSION_MAJOR == 3 && PETSC_VERSION_MINOR >= 1) //PETSc 3.1 or later
+PetscErrorCode PCSinglePrecisionIluApply(PC pc_object, Vec x, Vec y);
+#else
+PetscErrorCode PCSinglePrecisionIluApply(void* pc_context, Vec x, Vec y);
+#endif
+
+/**
+ * PETSc will call this function every time the preconditioner needs to be (re)built, i.e. on the
+ * first solve and whenever the matrix has changed and the preconditioner is not being reused.
+ *
+ * @param pc_object the PETSc preconditioner object (its shell context is a PCSinglePrecisionIluContext)
+ */
+#if (PETSC_VERSION_MAJOR == 3 && PETSC_VERSION_MINOR >= 1) //PETSc 3.1 or later
+PetscErrorCode PCSinglePrecisionIluSetUp(PC pc_object);
+#else
+PetscErrorCode PCSinglePrecisionIluSetUp(void* pc_context);
+#endif
+
+/**
+ * This class defines a PETSc-compliant purpose-built preconditioner.
+ *
+ * It is a block Jacobi preconditioner (one block per process) with an ILU(0)
+ * factorisation of each block, i.e. the same preconditioner as PETSc's default
+ * "bjacobi". The difference is that the incomplete factors are stored, and the
+ * triangular solves are performed, in single precision. Applying an ILU
+ * preconditioner is limited by memory bandwidth, so halving the size of the
+ * stored values reduces the cost of each application, while the Krylov
+ * iteration (matrix-vector products, inner products, convergence test) stays
+ * in double precision. The preconditioner is still a fixed linear operator, so
+ * the requested tolerance is met as usual, typically in the same number of
+ * iterations.
+ *
+ * The factorisation itself is computed in double precision and rounded when
+ * stored. Zero pivots are replaced by one.
+ */
+class PCSinglePrecisionIlu
+{
+public:
+
+    /**
+     * This struct defines the state of the preconditioner (the factors of the local diagonal block).
+     */
+    typedef struct{
+        PC pcObject; /**< The PETSc preconditioner object, used to get hold of the matrix to factorise*/
+        PetscInt numLocalRows; /**< Number of rows of the system matrix owned by this process*/
+        std::vector<PetscInt> rowStarts; /**< CSR row pointers of the factors (size numLocalRows+1)*/
+        std::vector<PetscInt> columnIndices; /**< CSR local column indices of the factors*/
+        std::vector<PetscInt> diagonalPositions; /**< Position of the diagonal entry of each row in columnIndices*/
+        std::vector<float> factorValues; /**< Off-diagonal entries of L (unit diagonal) and U, and 1/U_ii on the diagonal*/
+        std::vector<float> work; /**< Single precision work vector used in the triangular solves*/
+    } PCSinglePrecisionIluContext;
+
+    PCSinglePrecisionIluContext mPCContext; /**< PC context, this will be passed to PCSinglePrecisionIluApply and PCSinglePrecisionIluSetUp by PETSc.  See PCShellSetContext().*/
+    PC mPetscPCObject;/**< Generic PETSc preconditioner object */
+
+    /**
+     * Constructor. The factorisation is computed by PETSc calling PCSinglePrecisionIluSetUp()
+     * when the KSP object is set up.
+     *
+     * @param rKspObject KSP object where we want to install the preconditioner.
+     */
+    PCSinglePrecisionIlu(KSP& rKspObject);
+
+    /**
+     * @return the number of bytes of factor data (values and column indices) that are read from
+     * memory each time the preconditioner is applied. The equivalent figure for a double precision
+     * ILU(0) is obtained by replacing sizeof(float) with sizeof(double).
+     */
+    unsigned long GetFactorStorageBytes() const;
+};
+
+#endif /*PCSINGLEPRECISIONILU_HPP_*/
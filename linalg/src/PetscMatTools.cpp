@@ -36,6 +36,7 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "PetscMatTools.hpp"
 #include <algorithm>
 #include <cassert>
+#include <cstring>
 
 
 ///////////////////////////////////////////////////////////////////////////////////
@@ -418,3 +419,48 @@ void PetscMatTools::TurnOffVariableAllocationError(Mat matrix)
 #endif
 }
 
+bool PetscMatTools::GetSeqAijArrays(Mat matrix, PetscInt& rNumRows, const PetscInt*& rpRowStarts,
+                                    const PetscInt*& rpColumnIndices, PetscScalar*& rpValues)
+{
+#if (PETSC_VERSION_MAJOR == 3 && PETSC_VERSION_MINOR >= 4) //PETSc 3.4 or later
+    MatType type;
+    MatGetType(matrix, &type);
+    if (type == nullptr || strcmp(type, MATSEQAIJ) != 0)
+    {
+        return false;
+    }
+
+    PetscBool assembled;
+    MatAssembled(matrix, &assembled);
+    if (!assembled)
+    {
+        return false;
+    }
+
+    PetscBool done;
+    MatGetRowIJ(matrix, 0, PETSC_FALSE, PETSC_FALSE, &rNumRows, &rpRowStarts, &rpColumnIndices, &done);
+    if (!done)
+    {
+        return false; // LCOV_EXCL_LINE
+    }
+    MatSeqAIJGetArray(matrix, &rpValues);
+    return true;
+#else
+    return false;
+#endif
+}
+
+void PetscMatTools::RestoreSeqAijArrays(Mat matrix, PetscInt& rNumRows, const PetscInt*& rpRowStarts,
+                                        const PetscInt*& rpColumnIndices, PetscScalar*& rpValues)
+{
+#if (PETSC_VERSION_MAJOR == 3 && PETSC_VERSION_MINOR >= 4) //PETSc 3.4 or later
+    MatSeqAIJRestoreArray(matrix, &rpValues);
+
+    PetscBool done;
+    MatRestoreRowIJ(matrix, 0, PETSC_FALSE, PETSC_FALSE, &rNumRows, &rpRowStarts, &rpColumnIndices, &done);
+#endif
+    rpRowStarts = nullptr;
+    rpColumnIndices = nullptr;
+    rpValues = nullptr;
+}
+
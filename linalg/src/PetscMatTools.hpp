@@ -223,6 +223,39 @@ public:
      */
     static void TurnOffVariableAllocationError(Mat matrix);
 
+    /**
+     * Get direct access to the compressed row storage of a sequential AIJ matrix, so that
+     * values can be added in place without going through MatSetValues(). The matrix must
+     * already have been assembled, so that its sparsity pattern is known. Each successful
+     * call must be matched by a call to RestoreSeqAijArrays() before the matrix is used
+     * in any other way.
+     *
+     *  ** Only available in PETSc 3.4 and later **
+     *
+     * @param matrix The matrix
+     * @param rNumRows Filled in with the number of rows
+     * @param rpRowStarts Filled in with the offset of the first stored entry of each row, and
+     *     the total number of stored entries (rNumRows+1 values)
+     * @param rpColumnIndices Filled in with the column index of each stored entry, in increasing
+     *     order within each row
+     * @param rpValues Filled in with the value of each stored entry
+     * @return whether access was granted, which is false unless the matrix is an assembled MATSEQAIJ matrix
+     */
+    static bool GetSeqAijArrays(Mat matrix, PetscInt& rNumRows, const PetscInt*& rpRowStarts,
+                                const PetscInt*& rpColumnIndices, PetscScalar*& rpValues);
+
+    /**
+     * Release the access granted by a successful call to GetSeqAijArrays().
+     *
+     * @param matrix The matrix
+     * @param rNumRows The number of rows
+     * @param rpRowStarts The row offsets, which are reset to NULL
+     * @param rpColumnIndices The column indices, which are reset to NULL
+     * @param rpValues The values, which are reset to NULL
+     */
+    static void RestoreSeqAijArrays(Mat matrix, PetscInt& rNumRows, const PetscInt*& rpRowStarts,
+                                    const PetscInt*& rpColumnIndices, PetscScalar*& rpValues);
+
     /**
      * Add multiple values to a matrix.
      *
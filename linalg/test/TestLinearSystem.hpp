@@ -59,6 +59,49 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  */
 class TestLinearSystem : public CxxTest::TestSuite
 {
+private:
+
+    /**
+     * Assemble a tridiagonal system with the given diagonal and -1 off the diagonal,
+     * whose solution is all ones.
+     */
+    void AssembleTridiagonalSystem(LinearSystem& rLs, unsigned size, double diagonal)
+    {
+        PetscInt lo, hi;
+        rLs.GetOwnershipRange(lo, hi);
+
+        rLs.ZeroLinearSystem();
+        for (PetscInt row=lo; row<hi; row++)
+        {
+            rLs.SetMatrixElement(row, row, diagonal);
+            double row_sum = diagonal;
+            if (row > 0)
+            {
+                rLs.SetMatrixElement(row, row-1, -1.0);
+                row_sum -= 1.0;
+            }
+            if (row+1 < (PetscInt)size)
+            {
+                rLs.SetMatrixElement(row, row+1, -1.0);
+                row_sum -= 1.0;
+            }
+            rLs.SetRhsVectorElement(row, row_sum);
+        }
+        rLs.AssembleFinalLinearSystem();
+    }
+
+    /** Solve the system and check that the solution is all ones. */
+    void SolveAndCheckSolutionIsOnes(LinearSystem& rLs, unsigned size)
+    {
+        Vec solution = rLs.Solve();
+        ReplicatableVector solution_repl(solution);
+        for (unsigned i=0; i<size; i++)
+        {
+            TS_ASSERT_DELTA(solution_repl[i], 1.0, 1e-8);
+        }
+        PetscTools::Destroy(solution);
+    }
+
 public:
 
    void TestLinearSystem1()
@@ -1312,6 +1355,74 @@ public:
         PetscTools::Destroy(system_rhs);
     }
 
+    void TestPreconditionerReuse()
+    {
+        const unsigned size = 10u;
+        LinearSystem ls(size, 3);
+        ls.SetAbsoluteTolerance(1e-10);
+        ls.SetKspType("cg");
+        ls.SetPcType("jacobi");
+        ls.SetPreconditionerReuse(3);
+
+        for (unsigned solve=0; solve<8; solve++)
+        {
+            // The matrix values drift slightly between solves
+            AssembleTridiagonalSystem(ls, size, 4.0 + 0.01*solve);
+
+            if (solve == 6)
+            {
+                ls.RequestPreconditionerRebuild();
+            }
+
+            SolveAndCheckSolutionIsOnes(ls, size);
+        }
+
+#if (PETSC_VERSION_MAJOR==3 && PETSC_VERSION_MINOR >= 5) //PETSc 3.5 or later
+        // Set up on the first solve, rebuilt on the fourth (after 3 solves) and on the seventh (as requested)
+        TS_ASSERT_EQUALS(ls.GetNumPreconditionerSetUps(), 3u);
+#else
+        TS_ASSERT_EQUALS(ls.GetNumPreconditionerSetUps(), 1u);
+#endif
+    }
+
+    void TestPreconditionerRebuiltAfterSlowSolve()
+    {
+        const unsigned size = 10u;
+        LinearSystem ls(size, 3);
+        ls.SetAbsoluteTolerance(1e-10);
+        ls.SetKspType("cg");
+        ls.SetPcType("jacobi");
+
+        // Never rebuild because of the number of solves, and with no limit on the number of iterations
+        ls.SetPreconditionerReuse(100);
+
+        // Set up the preconditioner, then reuse it
+        AssembleTridiagonalSystem(ls, size, 4.0);
+        SolveAndCheckSolutionIsOnes(ls, size);
+        AssembleTridiagonalSystem(ls, size, 4.5);
+        SolveAndCheckSolutionIsOnes(ls, size);
+        unsigned num_iterations = ls.GetNumIterations();
+        TS_ASSERT_LESS_THAN(0u, num_iterations);
+
+        // A previous solve taking exactly the maximum number of iterations does not trigger a rebuild...
+        ls.SetPreconditionerReuse(100, num_iterations);
+        AssembleTridiagonalSystem(ls, size, 4.5);
+        SolveAndCheckSolutionIsOnes(ls, size);
+        TS_ASSERT_EQUALS(ls.GetNumIterations(), num_iterations);
+
+        // ...but one taking more than the maximum does
+        ls.SetPreconditionerReuse(100, num_iterations-1);
+        AssembleTridiagonalSystem(ls, size, 4.5);
+        SolveAndCheckSolutionIsOnes(ls, size);
+
+#if (PETSC_VERSION_MAJOR==3 && PETSC_VERSION_MINOR >= 5) //PETSc 3.5 or later
+        // Set up on the first solve and rebuilt on the fourth, after the slow third solve
+        TS_ASSERT_EQUALS(ls.GetNumPreconditionerSetUps(), 2u);
+#else
+        TS_ASSERT_EQUALS(ls.GetNumPreconditionerSetUps(), 1u);
+#endif
+    }
+
 //    void TestSingularSolves()
 //    {
 //        LinearSystem ls(2);
@@ -0,0 +1,221 @@
+/*
+
+Copyright (c) 2005-2017, University of Oxford.
+All rights reserved.
+
+University of Oxford means the Chancellor, Masters and Scholars of the
+University of Oxford, having an administrative office at Wellington
+Square, Oxford OX1 2JD, UK.
+
+This file is part of Chaste.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+ * Redistributions of source code must retain the above copyright notice,
+   this list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+ * Neither the name of the University of Oxford nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#ifndef TESTPCSINGLEPRECISIONILU_HPP_
+#define TESTPCSINGLEPRECISIONILU_HPP_
+
+#include <cxxtest/TestSuite.h>
+#include "LinearSystem.hpp"
+#include "PetscSetupAndFinalize.hpp"
+#include "ReplicatableVector.hpp"
+#include "Timer.hpp"
+#include "DistributedVectorFactory.hpp"
+#include "Warnings.hpp"
+#include <cstring>
+
+class TestPCSinglePrecisionIlu : public CxxTest::TestSuite
+{
+public:
+
+    void TestBasicFunctionality()
+    {
+        const unsigned size = 100u;
+        LinearSystem ls(size, 3);
+        ls.SetAbsoluteTolerance(1e-10);
+        ls.SetKspType("cg");
+        ls.SetPcType("singleprecisionilu");
+
+        PetscInt lo, hi;
+        ls.GetOwnershipRange(lo, hi);
+
+        // A tridiagonal matrix with solution all ones
+        for (unsigned row=(unsigned)lo; row<(unsigned)hi; row++)
+        {
+            double rhs = 4.0;
+            ls.SetMatrixElement(row, row, 4.0);
+            if (row > 0)
+            {
+                ls.SetMatrixElement(row, row-1, -1.0);
+                rhs -= 1.0;
+            }
+            if (row < size-1)
+            {
+                ls.SetMatrixElement(row, row+1, -1.0);
+                rhs -= 1.0;
+            }
+            ls.SetRhsVectorElement(row, rhs);
+        }
+        ls.AssembleFinalLinearSystem();
+
+        Vec solution = ls.Solve();
+
+        ReplicatableVector solution_repl(solution);
+        for (unsigned i=0; i<size; i++)
+        {
+            TS_ASSERT_DELTA(solution_repl[i], 1.0, 1e-8);
+        }
+
+        if (PetscTools::IsSequential())
+        {
+            // ILU(0) of a tridiagonal matrix is its exact LU factorisation, so the only error left
+            // for the Krylov iteration to remove is due to storing the factors in single precision
+            TS_ASSERT_LESS_THAN_EQUALS(ls.GetNumIterations(), 3u);
+
+            // 3 entries per row, apart from the first and last rows
+            TS_ASSERT_EQUALS(ls.mpSinglePrecisionIluPC->GetFactorStorageBytes(), (3*size-2)*(sizeof(float)+sizeof(PetscInt)));
+        }
+
+        PetscTools::Destroy(solution);
+
+        // Coverage (setting PC type after first solve)
+        ls.SetPcType("singleprecisionilu");
+
+#if (PETSC_VERSION_MAJOR == 3 && PETSC_VERSION_MINOR <= 3) //PETSc 3.0 to PETSc 3.3
+        const PCType pc;
+#else
+        PCType pc;
+#endif
+        PC prec;
+        KSPGetPC(ls.mKspSolver, &prec);
+        PCGetType(prec, &pc);
+        TS_ASSERT( strcmp(pc,"shell")==0 );
+    }
+
+    void TestAgainstDoublePrecisionIlu()
+    {
+        unsigned num_nodes = 1331;
+        DistributedVectorFactory factory(num_nodes);
+        Vec parallel_layout = factory.CreateVec(2);
+
+        unsigned double_precision_its;
+        unsigned single_precision_its;
+
+        Timer::Reset();
+        {
+            Mat system_matrix;
+            // Note that this test deadlocks if the file's not on the disk
+            PetscTools::ReadPetscObject(system_matrix, "linalg/test/data/matrices/cube_6000elems_half_activated.mat", parallel_layout);
+
+            Vec system_rhs;
+            // Note that this test deadlocks if the file's not on the disk
+            PetscTools::ReadPetscObject(system_rhs, "linalg/test/data/matrices/cube_6000elems_half_activated.vec", parallel_layout);
+
+            LinearSystem ls = LinearSystem(system_rhs, system_matrix);
+
+            ls.SetAbsoluteTolerance(1e-9);
+            ls.SetKspType("cg");
+            ls.SetPcType("bjacobi");
+
+            Vec solution = ls.Solve();
+
+            double_precision_its = ls.GetNumIterations();
+
+            PetscTools::Destroy(system_matrix);
+            PetscTools::Destroy(system_rhs);
+            PetscTools::Destroy(solution);
+        }
+        Timer::PrintAndReset("Block Jacobi ILU(0), double precision");
+
+        {
+            Mat system_matrix;
+            // Note that this test deadlocks if the file's not on the disk
+            PetscTools::ReadPetscObject(system_matrix, "linalg/test/data/matrices/cube_6000elems_half_activated.mat", parallel_layout);
+
+            Vec system_rhs;
+            // Note that this test deadlocks if the file's not on the disk
+            PetscTools::ReadPetscObject(system_rhs, "linalg/test/data/matrices/cube_6000elems_half_activated.vec", parallel_layout);
+
+            LinearSystem ls = LinearSystem(system_rhs, system_matrix);
+
+            ls.SetAbsoluteTolerance(1e-9);
+            ls.SetKspType("cg");
+            ls.SetPcType("singleprecisionilu");
+
+            Vec solution = ls.Solve();
+
+            single_precision_its = ls.GetNumIterations();
+
+            PetscTools::Destroy(system_matrix);
+            PetscTools::Destroy(system_rhs);
+            PetscTools::Destroy(solution);
+        }
+        Timer::Print("Block Jacobi ILU(0), single precision");
+
+        PetscTools::Destroy(parallel_layout);
+
+        // Same preconditioner up to rounding, so convergence should be essentially unaffected
+        TS_ASSERT_LESS_THAN_EQUALS(single_precision_its, double_precision_its + 5);
+        TS_ASSERT_LESS_THAN_EQUALS(double_precision_its, single_precision_its + 5);
+    }
+
+    void TestZeroPivotIsReported()
+    {
+        // A permutation matrix has a zero diagonal, so ILU(0) cannot be computed without altering pivots
+        const unsigned size = 2u;
+        LinearSystem ls(size, 2);
+        ls.SetAbsoluteTolerance(1e-10);
+        ls.SetKspType("gmres");
+        ls.SetPcType("singleprecisionilu");
+
+        PetscInt lo, hi;
+        ls.GetOwnershipRange(lo, hi);
+        for (unsigned row=(unsigned)lo; row<(unsigned)hi; row++)
+        {
+            ls.SetMatrixElement(row, 1-row, 1.0);
+            ls.SetRhsVectorElement(row, 1.0);
+        }
+        ls.AssembleFinalLinearSystem();
+
+        Vec solution = ls.Solve();
+
+        // The preconditioner is still non-singular, so the Krylov solver converges
+        ReplicatableVector solution_repl(solution);
+        for (unsigned i=0; i<size; i++)
+        {
+            TS_ASSERT_DELTA(solution_repl[i], 1.0, 1e-8);
+        }
+        PetscTools::Destroy(solution);
+
+        if (PetscTools::IsSequential())
+        {
+            TS_ASSERT_EQUALS(Warnings::Instance()->GetNumWarnings(), 1u);
+            TS_ASSERT_EQUALS(Warnings::Instance()->GetNextWarningMessage(),
+                             "Single precision ILU(0) met 1 zero pivot(s) on process 0, which have been replaced by one");
+        }
+        Warnings::Instance()->QuietDestroy();
+    }
+};
+
+#endif /*TESTPCSINGLEPRECISIONILU_HPP_*/
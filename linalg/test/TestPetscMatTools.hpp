@@ -180,6 +180,64 @@ public:
 
         PetscTools::Destroy(matrix);
     }
+
+    void TestGetSeqAijArrays()
+    {
+        Mat matrix;
+        const unsigned size = 4u;
+        PetscTools::SetupMat(matrix, size, size, 3);
+
+        PetscInt num_rows;
+        const PetscInt* p_row_starts;
+        const PetscInt* p_column_indices;
+        PetscScalar* p_values;
+
+        // A tridiagonal matrix that has not yet been assembled
+        for (unsigned row=0; row<size; row++)
+        {
+            for (unsigned col=(row==0 ? 0 : row-1); col<=row+1 && col<size; col++)
+            {
+                PetscMatTools::SetElement(matrix, row, col, 1.0);
+            }
+        }
+        TS_ASSERT_EQUALS(PetscMatTools::GetSeqAijArrays(matrix, num_rows, p_row_starts, p_column_indices, p_values), false);
+
+        PetscMatTools::Finalise(matrix);
+
+#if (PETSC_VERSION_MAJOR == 3 && PETSC_VERSION_MINOR >= 4) //PETSc 3.4 or later
+        if (PetscTools::IsSequential())
+        {
+            TS_ASSERT_EQUALS(PetscMatTools::GetSeqAijArrays(matrix, num_rows, p_row_starts, p_column_indices, p_values), true);
+            TS_ASSERT_EQUALS(num_rows, (PetscInt)size);
+
+            PetscInt correct_row_starts[5] = {0, 2, 5, 8, 10};
+            PetscInt correct_column_indices[10] = {0, 1, 0, 1, 2, 1, 2, 3, 2, 3};
+            for (unsigned i=0; i<=size; i++)
+            {
+                TS_ASSERT_EQUALS(p_row_starts[i], correct_row_starts[i]);
+            }
+            for (unsigned i=0; i<10; i++)
+            {
+                TS_ASSERT_EQUALS(p_column_indices[i], correct_column_indices[i]);
+                p_values[i] += (double)i;
+            }
+
+            PetscMatTools::RestoreSeqAijArrays(matrix, num_rows, p_row_starts, p_column_indices, p_values);
+            TS_ASSERT(p_values == nullptr);
+
+            TS_ASSERT_DELTA(PetscMatTools::GetElement(matrix, 0, 0), 1.0, 1e-12);
+            TS_ASSERT_DELTA(PetscMatTools::GetElement(matrix, 1, 2), 5.0, 1e-12);
+            TS_ASSERT_DELTA(PetscMatTools::GetElement(matrix, 3, 3), 10.0, 1e-12);
+        }
+        else
+        {
+            // Only sequential AIJ matrices are supported
+            TS_ASSERT_EQUALS(PetscMatTools::GetSeqAijArrays(matrix, num_rows, p_row_starts, p_column_indices, p_values), false);
+        }
+#endif
+
+        PetscTools::Destroy(matrix);
+    }
 };
 
 #endif /*TESTPETSCMATTOOLS_HPP_*/
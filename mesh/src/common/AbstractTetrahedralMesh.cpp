@@ -33,6 +33,9 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 */
 
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
 #include <limits>
 #include "AbstractTetrahedralMesh.hpp"
 
@@ -64,7 +67,9 @@ void AbstractTetrahedralMesh<ELEMENT_DIM, SPACE_DIM>::SetElementOwnerships()
 
 template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
 AbstractTetrahedralMesh<ELEMENT_DIM, SPACE_DIM>::AbstractTetrahedralMesh()
-    : mMeshIsLinear(true)
+    : mMeshIsLinear(true),
+      mElementSpatialIndexIsSetUp(false),
+      mElementBucketWidth(0.0)
 {
 }
 
@@ -1006,6 +1011,20 @@ unsigned AbstractTetrahedralMesh<ELEMENT_DIM, SPACE_DIM>::GetContainingElementIn
 
     if (!onlyTryWithTestElements)
     {
+        if (mElementSpatialIndexIsSetUp)
+        {
+            // Only elements whose bounding boxes overlap the bucket containing the point can contain it
+            const std::vector<unsigned>& r_candidates = rGetCandidateContainingElementIndices(rTestPoint);
+            for (unsigned i=0; i<r_candidates.size(); i++)
+            {
+                if (this->mElements[r_candidates[i]]->IncludesPoint(rTestPoint, strict))
+                {
+                    assert(!this->mElements[r_candidates[i]]->IsDeleted());
+                    return r_candidates[i];
+                }
+            }
+        }
+
         for (unsigned i=0; i<this->mElements.size(); i++)
         {
             if (this->mElements[i]->IncludesPoint(rTestPoint, strict))
@@ -1067,6 +1086,173 @@ unsigned AbstractTetrahedralMesh<ELEMENT_DIM, SPACE_DIM>::GetNearestElementIndex
     return closest_index;
 }
 
+template <unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+void AbstractTetrahedralMesh<ELEMENT_DIM, SPACE_DIM>::SetUpElementSpatialIndex()
+{
+    ClearElementSpatialIndex();
+
+    // Compute the bounding box of each element, padded to allow for the tolerance used in IncludesPoint()
+    std::vector<c_vector<double, SPACE_DIM> > element_lower(mElements.size());
+    std::vector<c_vector<double, SPACE_DIM> > element_upper(mElements.size());
+    c_vector<double, SPACE_DIM> lower;
+    c_vector<double, SPACE_DIM> upper;
+    for (unsigned k=0; k<SPACE_DIM; k++)
+    {
+        lower[k] = DBL_MAX;
+        upper[k] = -DBL_MAX;
+    }
+    double total_element_size = 0.0;
+    unsigned num_elements = 0;
+
+    for (unsigned i=0; i<mElements.size(); i++)
+    {
+        Element<ELEMENT_DIM, SPACE_DIM>* p_element = mElements[i];
+        if (p_element->IsDeleted())
+        {
+            continue;
+        }
+
+        element_lower[i] = p_element->GetNodeLocation(0);
+        element_upper[i] = p_element->GetNodeLocation(0);
+        for (unsigned local_index=1; local_index<p_element->GetNumNodes(); local_index++)
+        {
+            const c_vector<double, SPACE_DIM>& r_location = p_element->GetNodeLocation(local_index);
+            for (unsigned k=0; k<SPACE_DIM; k++)
+            {
+                element_lower[i][k] = std::min(element_lower[i][k], r_location[k]);
+                element_upper[i][k] = std::max(element_upper[i][k], r_location[k]);
+            }
+        }
+
+        double element_size = 0.0;
+        for (unsigned k=0; k<SPACE_DIM; k++)
+        {
+            element_size = std::max(element_size, element_upper[i][k] - element_lower[i][k]);
+        }
+        double padding = 1e-8*element_size;
+        for (unsigned k=0; k<SPACE_DIM; k++)
+        {
+            element_lower[i][k] -= padding;
+            element_upper[i][k] += padding;
+            lower[k] = std::min(lower[k], element_lower[i][k]);
+            upper[k] = std::max(upper[k], element_upper[i][k]);
+        }
+
+        total_element_size += element_size;
+        num_elements++;
+    }
+
+    if (num_elements == 0)
+    {
+        // Use a single empty bucket, so that every query falls back to an exhaustive search
+        mElementBucketOrigin = zero_vector<double>(SPACE_DIM);
+        mElementBucketWidth = 1.0;
+        mNumElementBuckets = scalar_vector<unsigned>(SPACE_DIM, 1u);
+        mElementBuckets.resize(1);
+        mElementSpatialIndexIsSetUp = true;
+        return;
+    }
+
+    // Use buckets about the size of a typical element, but avoid having many more buckets than elements
+    mElementBucketOrigin = lower;
+    mElementBucketWidth = total_element_size/num_elements;
+    if (mElementBucketWidth <= 0.0)
+    {
+        mElementBucketWidth = 1.0;
+    }
+    unsigned num_buckets;
+    while (true)
+    {
+        num_buckets = 1;
+        for (unsigned k=0; k<SPACE_DIM; k++)
+        {
+            mNumElementBuckets[k] = std::max(1u, (unsigned)ceil((upper[k] - lower[k])/mElementBucketWidth));
+            num_buckets *= mNumElementBuckets[k];
+        }
+        if (num_buckets <= 8*num_elements + 8)
+        {
+            break;
+        }
+        mElementBucketWidth *= 2.0;
+    }
+    mElementBuckets.resize(num_buckets);
+
+    // Add each element to every bucket overlapped by its bounding box, in increasing order of element index
+    for (unsigned i=0; i<mElements.size(); i++)
+    {
+        if (mElements[i]->IsDeleted())
+        {
+            continue;
+        }
+
+        c_vector<unsigned, SPACE_DIM> first_bucket;
+        c_vector<unsigned, SPACE_DIM> last_bucket;
+        for (unsigned k=0; k<SPACE_DIM; k++)
+        {
+            double first = floor((element_lower[i][k] - mElementBucketOrigin[k])/mElementBucketWidth);
+            double last = floor((element_upper[i][k] - mElementBucketOrigin[k])/mElementBucketWidth);
+            first_bucket[k] = (unsigned)std::min(std::max(first, 0.0), (double)(mNumElementBuckets[k] - 1));
+            last_bucket[k] = (unsigned)std::min(std::max(last, 0.0), (double)(mNumElementBuckets[k] - 1));
+        }
+
+        c_vector<unsigned, SPACE_DIM> bucket = first_bucket;
+        bool done = false;
+        while (!done)
+        {
+            unsigned bucket_index = 0;
+            for (unsigned k=SPACE_DIM; k-- > 0; )
+            {
+                bucket_index = bucket_index*mNumElementBuckets[k] + bucket[k];
+            }
+            mElementBuckets[bucket_index].push_back(i);
+
+            // Move on to the next bucket in the range, in odometer order
+            done = true;
+            for (unsigned k=0; k<SPACE_DIM; k++)
+            {
+                if (bucket[k] < last_bucket[k])
+                {
+                    bucket[k]++;
+                    done = false;
+                    break;
+                }
+                bucket[k] = first_bucket[k];
+            }
+        }
+    }
+
+    mElementSpatialIndexIsSetUp = true;
+}
+
+template <unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+void AbstractTetrahedralMesh<ELEMENT_DIM, SPACE_DIM>::ClearElementSpatialIndex()
+{
+    mElementBuckets.clear();
+    mElementSpatialIndexIsSetUp = false;
+}
+
+template <unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+bool AbstractTetrahedralMesh<ELEMENT_DIM, SPACE_DIM>::IsElementSpatialIndexSetUp() const
+{
+    return mElementSpatialIndexIsSetUp;
+}
+
+template <unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+const std::vector<unsigned>& AbstractTetrahedralMesh<ELEMENT_DIM, SPACE_DIM>::rGetCandidateContainingElementIndices(const ChastePoint<SPACE_DIM>& rTestPoint) const
+{
+    assert(mElementSpatialIndexIsSetUp);
+
+    // Points outside the grid are assigned to the nearest bucket
+    unsigned bucket_index = 0;
+    for (unsigned k=SPACE_DIM; k-- > 0; )
+    {
+        double bucket = floor((rTestPoint[k] - mElementBucketOrigin[k])/mElementBucketWidth);
+        unsigned bucket_k = (unsigned)std::min(std::max(bucket, 0.0), (double)(mNumElementBuckets[k] - 1));
+        bucket_index = bucket_index*mNumElementBuckets[k] + bucket_k;
+    }
+    return mElementBuckets[bucket_index];
+}
+
 // Explicit instantiation
 template class AbstractTetrahedralMesh<1,1>;
 template class AbstractTetrahedralMesh<1,2>;
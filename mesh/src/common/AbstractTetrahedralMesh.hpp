@@ -279,6 +279,24 @@ protected:  // Give access of these variables to subclasses
     /** Vector of pointers to boundary elements in the mesh. */
     std::vector<BoundaryElement<ELEMENT_DIM-1, SPACE_DIM> *> mBoundaryElements;
 
+    /** Whether the element spatial index has been set up by SetUpElementSpatialIndex(). */
+    bool mElementSpatialIndexIsSetUp;
+
+    /** The lower corner of the uniform grid of buckets used by the element spatial index. */
+    c_vector<double, SPACE_DIM> mElementBucketOrigin;
+
+    /** The width of each bucket of the element spatial index. */
+    double mElementBucketWidth;
+
+    /** The number of buckets of the element spatial index in each direction. */
+    c_vector<unsigned, SPACE_DIM> mNumElementBuckets;
+
+    /**
+     * For each bucket of the element spatial index, the indices (in increasing order) of
+     * the elements whose bounding boxes overlap that bucket.
+     */
+    std::vector<std::vector<unsigned> > mElementBuckets;
+
     /**
      * Sets the ownership of each element according to which nodes are owned by the
      * process.
@@ -623,6 +641,40 @@ public:
      unsigned GetNearestElementIndexFromTestElements(const ChastePoint<SPACE_DIM>& rTestPoint,
                                                      std::set<unsigned> testElements);
 
+     /**
+      * Set up a spatial index for point location queries, by binning the (slightly padded)
+      * bounding box of each element into a uniform grid of buckets whose width is
+      * comparable with the size of the elements. Once set up, GetContainingElementIndex()
+      * (and TetrahedralMesh::GetContainingElementIndexWithInitialGuess()) only test the
+      * elements in the bucket containing the point, while returning the same element as
+      * an exhaustive search would.
+      *
+      * The index is rebuilt by RefreshMesh(), but must otherwise be set up again (or cleared)
+      * if the nodes of the mesh are moved or elements are added or removed. MutableMesh
+      * clears it whenever it moves, adds or deletes nodes or elements, or remeshes.
+      */
+     void SetUpElementSpatialIndex();
+
+     /**
+      * Discard the element spatial index, so that point location queries revert to
+      * exhaustive searches.
+      */
+     void ClearElementSpatialIndex();
+
+     /**
+      * @return whether the element spatial index has been set up.
+      */
+     bool IsElementSpatialIndexSetUp() const;
+
+     /**
+      * @return the indices (in increasing order) of the only elements that may contain a test point,
+      * according to the element spatial index. Every element containing the point is included.
+      * The element spatial index must have been set up.
+      *
+      * @param rTestPoint reference to the point
+      */
+     const std::vector<unsigned>& rGetCandidateContainingElementIndices(const ChastePoint<SPACE_DIM>& rTestPoint) const;
+
     //////////////////////////////////////////////////////////////////////
     //                         Nested classes                           //
     //////////////////////////////////////////////////////////////////////
@@ -93,6 +93,7 @@ unsigned MutableMesh<ELEMENT_DIM, SPACE_DIM>::AddNode(Node<SPACE_DIM>* pNewNode)
         this->mNodes[index] = pNewNode;
     }
     mAddedNodes = true;
+    this->ClearElementSpatialIndex();
     return pNewNode->GetIndex();
 }
 
@@ -115,6 +116,7 @@ unsigned MutableMesh<ELEMENT_DIM, SPACE_DIM>::AddElement(Element<ELEMENT_DIM,SPA
         delete this->mElements[index];
         this->mElements[index] = pNewElement;
     }
+    this->ClearElementSpatialIndex();
 
     return pNewElement->GetIndex();
 }
@@ -177,6 +179,9 @@ void MutableMesh<ELEMENT_DIM, SPACE_DIM>::SetNode(unsigned index,
 {
     this->mNodes[index]->SetPoint(point);
 
+    // The bounding boxes of the elements containing this node may have changed
+    this->ClearElementSpatialIndex();
+
     if (concreteMove)
     {
         for (typename Node<SPACE_DIM>::ContainingBoundaryElementIterator it = this->mNodes[index]->ContainingBoundaryElementsBegin();
@@ -269,6 +274,7 @@ void MutableMesh<ELEMENT_DIM, SPACE_DIM>::DeleteElement(unsigned index)
     assert(!this->mElements[index]->IsDeleted());
     this->mElements[index]->MarkAsDeleted();
     mDeletedElementIndices.push_back(index);
+    this->ClearElementSpatialIndex();
 
     // Delete any nodes that are no longer attached to mesh
     for (unsigned node_index = 0; node_index < this->mElements[index]->GetNumNodes(); ++node_index)
@@ -353,6 +359,8 @@ void MutableMesh<ELEMENT_DIM, SPACE_DIM>::MoveMergeNode(unsigned index,
         }
     }
 
+    // Moving the node changes the elements containing it, even if the move is not made concrete
+    this->ClearElementSpatialIndex();
     this->mNodes[index]->rGetModifiableLocation() = this->mNodes[targetIndex]->rGetLocation();
 
     for (std::set<unsigned>::const_iterator element_iter=unshared_element_indices.begin();
@@ -521,6 +529,7 @@ void MutableMesh<ELEMENT_DIM, SPACE_DIM>::DeleteBoundaryNodeAt(unsigned index)
 
     this->mNodes[index]->MarkAsDeleted();
     mDeletedNodeIndices.push_back(index);
+    this->ClearElementSpatialIndex();
 
     // Update the boundary node vector
     typename std::vector<Node<SPACE_DIM>*>::iterator b_node_iter
@@ -566,6 +575,9 @@ void MutableMesh<ELEMENT_DIM, SPACE_DIM>::ReIndex(NodeMap& map)
     assert(!mAddedNodes);
     map.Resize(this->GetNumAllNodes());
 
+    // Elements are renumbered below, so any spatial index built on them is no longer valid
+    this->ClearElementSpatialIndex();
+
     std::vector<Element<ELEMENT_DIM, SPACE_DIM> *> live_elements;
 
     for (unsigned i=0; i<this->mElements.size(); i++)
@@ -687,6 +699,10 @@ void MutableMesh<ELEMENT_DIM, SPACE_DIM>::ReMesh(NodeMap& map)
 
     // Make sure the map is big enough
     map.Resize(this->GetNumAllNodes());
+
+    // The elements are about to be replaced, so any spatial index built on them is no longer valid
+    this->ClearElementSpatialIndex();
+
     if (mAddedNodes || !mDeletedNodeIndices.empty())
     {
         // Size of mesh is about to change
@@ -34,8 +34,8 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 */
 
 #include <map>
+#include <algorithm>
 #include "NodesOnlyMesh.hpp"
-#include "ChasteCuboid.hpp"
 
 template<unsigned SPACE_DIM>
 NodesOnlyMesh<SPACE_DIM>::NodesOnlyMesh()
@@ -661,6 +661,68 @@ void NodesOnlyMesh<SPACE_DIM>::LoadBalanceMesh()
     SetUpBoxCollection(mMaximumInteractionDistance, current_domain_size, new_rows);
 }
 
+template<unsigned SPACE_DIM>
+uint64_t NodesOnlyMesh<SPACE_DIM>::CalculateMortonKey(const c_vector<double, SPACE_DIM>& rLocation, const ChasteCuboid<SPACE_DIM>& rBoundingBox)
+{
+    // Use as many bits per dimension as will fit in the key (31 in 1D and 2D, 21 in 3D)
+    const unsigned bits_per_dim = std::min(31u, 63u/SPACE_DIM);
+    const double max_coordinate = (double)((1ull << bits_per_dim) - 1);
+
+    uint64_t coordinates[SPACE_DIM];
+    for (unsigned d=0; d<SPACE_DIM; d++)
+    {
+        double lower = rBoundingBox.rGetLowerCorner()[d];
+        double width = rBoundingBox.rGetUpperCorner()[d] - lower;
+        double scaled = (width > 0.0) ? (rLocation[d] - lower)/width : 0.0;
+        scaled = std::max(0.0, std::min(1.0, scaled));
+        coordinates[d] = (uint64_t)(scaled*max_coordinate);
+    }
+
+    // Interleave the bits of the quantised coordinates
+    uint64_t key = 0;
+    for (unsigned bit=0; bit<bits_per_dim; bit++)
+    {
+        for (unsigned d=0; d<SPACE_DIM; d++)
+        {
+            key |= ((coordinates[d] >> bit) & 1ull) << (bit*SPACE_DIM + d);
+        }
+    }
+    return key;
+}
+
+template<unsigned SPACE_DIM>
+void NodesOnlyMesh<SPACE_DIM>::ReorderNodesAlongSpaceFillingCurve()
+{
+    if (!this->mDeletedNodeIndices.empty())
+    {
+        EXCEPTION("Deleted nodes must be removed by calling ReMesh() before the nodes can be reordered");
+    }
+
+    if (this->mNodes.size() < 2)
+    {
+        return;
+    }
+
+    ChasteCuboid<SPACE_DIM> bounding_box = this->CalculateBoundingBox(this->mNodes);
+
+    // Sort by key, breaking ties by global index so that the ordering is reproducible
+    std::vector<std::pair<std::pair<uint64_t, unsigned>, unsigned> > keyed_positions(this->mNodes.size());
+    for (unsigned i=0; i<this->mNodes.size(); i++)
+    {
+        uint64_t key = CalculateMortonKey(this->mNodes[i]->rGetLocation(), bounding_box);
+        keyed_positions[i] = std::make_pair(std::make_pair(key, this->mNodes[i]->GetIndex()), i);
+    }
+    std::sort(keyed_positions.begin(), keyed_positions.end());
+
+    std::vector<Node<SPACE_DIM>*> old_nodes = this->mNodes;
+    for (unsigned i=0; i<keyed_positions.size(); i++)
+    {
+        this->mNodes[i] = old_nodes[keyed_positions[i].second];
+    }
+
+    UpdateNodeIndices();
+}
+
 template<unsigned SPACE_DIM>
 void NodesOnlyMesh<SPACE_DIM>::ConstructFromMeshReader(AbstractMeshReader<SPACE_DIM, SPACE_DIM>& rMeshReader)
 {
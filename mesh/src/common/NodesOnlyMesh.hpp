@@ -40,8 +40,11 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <boost/serialization/base_object.hpp>
 #include <boost/serialization/map.hpp>
 
+#include <stdint.h>
+
 #include "SmartPointers.hpp"
 #include "PetscTools.hpp"
+#include "ChasteCuboid.hpp"
 #include "DistributedBoxCollection.hpp"
 #include "MutableMesh.hpp"
 /**
@@ -206,6 +209,17 @@ private:
       */
      void AddNodeWithFixedIndex(Node<SPACE_DIM>* pNewNode);
 
+     /**
+      * Calculate the position of a point along a Morton (Z-order) space-filling curve.
+      * Each coordinate is quantised to an integer grid spanning the given bounding box
+      * and the bits of the resulting integers are interleaved.
+      *
+      * @param rLocation the location of the point.
+      * @param rBoundingBox a cuboid containing the point.
+      * @return the Morton key of the point.
+      */
+     static uint64_t CalculateMortonKey(const c_vector<double, SPACE_DIM>& rLocation, const ChasteCuboid<SPACE_DIM>& rBoundingBox);
+
 protected:
 
     /**  Clear the BoxCollection  */
@@ -475,6 +489,18 @@ public:
      */
     void LoadBalanceMesh();
 
+    /**
+     * Reorder the local storage of the nodes on this process along a Morton space-filling
+     * curve, so that nodes which are close in space are also close in mNodes. This restores
+     * the memory locality of the node and box loops, which is lost as nodes move, divide and die.
+     *
+     * Only the local storage order (and hence mNodesMapping) is changed; the global node indices
+     * are left untouched, so any maps from global node indices to cells remain valid. Must be
+     * called after ReMesh(), when there are no deleted nodes in mNodes, and should be followed
+     * by UpdateBoxCollection().
+     */
+    void ReorderNodesAlongSpaceFillingCurve();
+
     /**
      * Overridden ConstructFromMeshReader to correctly assign global node indices on load.
      *
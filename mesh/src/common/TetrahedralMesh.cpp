@@ -375,6 +375,43 @@ unsigned TetrahedralMesh<ELEMENT_DIM, SPACE_DIM>::GetContainingElementIndexWithI
 {
     assert(startingElementGuess<this->GetNumElements());
 
+    if (this->mElementSpatialIndexIsSetUp)
+    {
+        if (this->mElements[startingElementGuess]->IncludesPoint(rTestPoint, strict))
+        {
+            assert(!this->mElements[startingElementGuess]->IsDeleted());
+            return startingElementGuess;
+        }
+
+        /*
+         * Searching in the order below is equivalent to choosing, from the elements containing
+         * the point, the one with the smallest offset from startingElementGuess (modulo the
+         * number of elements). Only the candidates given by the spatial index need be tested.
+         */
+        unsigned num_elements = this->GetNumElements();
+        unsigned best_index = UNSIGNED_UNSET;
+        unsigned best_offset = UNSIGNED_UNSET;
+        const std::vector<unsigned>& r_candidates = this->rGetCandidateContainingElementIndices(rTestPoint);
+        for (unsigned i=0; i<r_candidates.size(); i++)
+        {
+            unsigned candidate = r_candidates[i];
+            if (candidate < num_elements)
+            {
+                unsigned offset = (candidate + num_elements - startingElementGuess)%num_elements;
+                if ((offset < best_offset) && this->mElements[candidate]->IncludesPoint(rTestPoint, strict))
+                {
+                    best_index = candidate;
+                    best_offset = offset;
+                }
+            }
+        }
+        if (best_index != UNSIGNED_UNSET)
+        {
+            assert(!this->mElements[best_index]->IsDeleted());
+            return best_index;
+        }
+    }
+
     /*
      * Let m=startingElementGuess, N=num_elem-1.
      * We search from in this order: m, m+1, m+2, .. , N, 0, 1, .., m-1.
@@ -479,6 +516,8 @@ void TetrahedralMesh<ELEMENT_DIM, SPACE_DIM>::Clear()
     this->mElements.clear();
     this->mBoundaryElements.clear();
     this->mBoundaryNodes.clear();
+
+    this->ClearElementSpatialIndex();
 }
 
 
@@ -649,6 +688,11 @@ template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
 void TetrahedralMesh<ELEMENT_DIM, SPACE_DIM>::RefreshMesh()
 {
     RefreshJacobianCachedData();
+
+    if (this->mElementSpatialIndexIsSetUp)
+    {
+        this->SetUpElementSpatialIndex();
+    }
 }
 
 template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
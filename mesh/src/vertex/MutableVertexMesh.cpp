@@ -357,6 +357,7 @@ unsigned MutableVertexMesh<ELEMENT_DIM, SPACE_DIM>::AddElement(VertexElement<ELE
         this->mElements[new_element_index] = pNewElement;
     }
     pNewElement->RegisterWithNodes();
+    this->InvalidateElementGeometryCache();
     return pNewElement->GetIndex();
 }
 
@@ -364,6 +365,7 @@ template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
 void MutableVertexMesh<ELEMENT_DIM, SPACE_DIM>::SetNode(unsigned nodeIndex, ChastePoint<SPACE_DIM> point)
 {
     this->mNodes[nodeIndex]->SetPoint(point);
+    this->InvalidateElementGeometryCacheForNode(nodeIndex);
 }
 
 template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
@@ -688,6 +690,8 @@ unsigned MutableVertexMesh<ELEMENT_DIM, SPACE_DIM>::DivideElement(VertexElement<
         }
     }
 
+    this->InvalidateElementGeometryCache();
+
     return new_element_index;
 }
 
@@ -796,6 +800,8 @@ void MutableVertexMesh<ELEMENT_DIM, SPACE_DIM>::DivideEdge(Node<SPACE_DIM>* pNod
         // Add new node to this element
         this->GetElement(*iter)->AddNode(p_new_node, index);
     }
+
+    this->InvalidateElementGeometryCache();
 }
 
 template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
@@ -887,15 +893,16 @@ void MutableVertexMesh<ELEMENT_DIM, SPACE_DIM>::ReMesh(VertexElementMap& rElemen
          * mesh. Instead, we just remove any deleted elements and nodes.
          */
         RemoveDeletedNodesAndElements(rElementMap);
-        bool recheck_mesh = true;
-        while (recheck_mesh == true)
-        {
-            // We check for any short edges and perform swaps if necessary and possible.
-            recheck_mesh = CheckForSwapsFromShortEdges();
-        }
+
+        // Local remeshing operations move nodes directly, so do not use cached element geometry while remeshing
+        bool use_element_geometry_cache = this->mUseElementGeometryCache;
+        this->mUseElementGeometryCache = false;
+
+        // We check for any short edges and perform swaps if necessary and possible.
+        PerformSwapsFromShortEdges();
 
         // Check for element intersections
-        recheck_mesh = true;
+        bool recheck_mesh = true;
         while (recheck_mesh == true)
         {
             // Check mesh for intersections, and perform T3 swaps where required
@@ -909,6 +916,8 @@ void MutableVertexMesh<ELEMENT_DIM, SPACE_DIM>::ReMesh(VertexElementMap& rElemen
          * (see #2664).
          */
         this->CheckForRosettes();
+
+        this->SetUseElementGeometryCache(use_element_geometry_cache);
     }
     else // 3D
     {
@@ -929,62 +938,142 @@ void MutableVertexMesh<ELEMENT_DIM, SPACE_DIM>::ReMesh()
 template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
 bool MutableVertexMesh<ELEMENT_DIM, SPACE_DIM>::CheckForSwapsFromShortEdges()
 {
+    std::set<unsigned> affected_elements;
+
     // Loop over elements to check for T1 swaps
     for (typename VertexMesh<ELEMENT_DIM, SPACE_DIM>::VertexElementIterator elem_iter = this->GetElementIteratorBegin();
          elem_iter != this->GetElementIteratorEnd();
          ++elem_iter)
     {
-        ///\todo Could we search more efficiently by just iterating over edges? (see #2401)
+        // If a swap is performed then halt the search, returning true
+        if (CheckElementForSwapsFromShortEdges(elem_iter->GetIndex(), affected_elements))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+bool MutableVertexMesh<ELEMENT_DIM, SPACE_DIM>::CheckElementForSwapsFromShortEdges(unsigned elementIndex, std::set<unsigned>& rAffectedElements)
+{
+    VertexElement<ELEMENT_DIM, SPACE_DIM>* p_element = this->mElements[elementIndex];
+    unsigned num_nodes = p_element->GetNumNodes();
+    assert(num_nodes > 0);
+
+    // Loop over the nodes contained in this element
+    for (unsigned local_index=0; local_index<num_nodes; local_index++)
+    {
+        // Find locations of the current node and anticlockwise node
+        Node<SPACE_DIM>* p_current_node = p_element->GetNode(local_index);
+        unsigned local_index_plus_one = (local_index+1)%num_nodes;    ///\todo Use iterators to tidy this up (see #2401)
+        Node<SPACE_DIM>* p_anticlockwise_node = p_element->GetNode(local_index_plus_one);
 
-        unsigned num_nodes = elem_iter->GetNumNodes();
-        assert(num_nodes > 0);
+        // Find distance between nodes
+        double distance_between_nodes = this->GetDistanceBetweenNodes(p_current_node->GetIndex(), p_anticlockwise_node->GetIndex());
 
-        // Loop over the nodes contained in this element
-        for (unsigned local_index=0; local_index<num_nodes; local_index++)
+        // If the nodes are too close together...
+        if (distance_between_nodes < mCellRearrangementThreshold)
         {
-            // Find locations of the current node and anticlockwise node
-            Node<SPACE_DIM>* p_current_node = elem_iter->GetNode(local_index);
-            unsigned local_index_plus_one = (local_index+1)%num_nodes;    ///\todo Use iterators to tidy this up (see #2401)
-            Node<SPACE_DIM>* p_anticlockwise_node = elem_iter->GetNode(local_index_plus_one);
+            // ...then check if any triangular elements are shared by these nodes...
+            const std::set<unsigned>& r_elements_of_node_a = p_current_node->rGetContainingElementIndices();
+            const std::set<unsigned>& r_elements_of_node_b = p_anticlockwise_node->rGetContainingElementIndices();
+
+            std::set<unsigned> shared_elements;
+            std::set_intersection(r_elements_of_node_a.begin(), r_elements_of_node_a.end(),
+                                  r_elements_of_node_b.begin(), r_elements_of_node_b.end(),
+                                  std::inserter(shared_elements, shared_elements.begin()));
+
+            bool both_nodes_share_triangular_element = false;
+            for (std::set<unsigned>::const_iterator it = shared_elements.begin();
+                 it != shared_elements.end();
+                 ++it)
+            {
+                if (this->GetElement(*it)->GetNumNodes() <= 3)
+                {
+                    both_nodes_share_triangular_element = true;
+                    break;
+                }
+            }
+
+            // ...and if none are, then record the elements affected, perform the required type of swap and return true
+            if (!both_nodes_share_triangular_element)
+            {
+                rAffectedElements.clear();
+                std::set_union(r_elements_of_node_a.begin(), r_elements_of_node_a.end(),
+                               r_elements_of_node_b.begin(), r_elements_of_node_b.end(),
+                               std::inserter(rAffectedElements, rAffectedElements.begin()));
+
+                IdentifySwapType(p_current_node, p_anticlockwise_node);
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+void MutableVertexMesh<ELEMENT_DIM, SPACE_DIM>::PerformSwapsFromShortEdges()
+{
+    // Initially every element may contain a short edge
+    std::set<unsigned> elements_to_check;
+    for (typename VertexMesh<ELEMENT_DIM, SPACE_DIM>::VertexElementIterator elem_iter = this->GetElementIteratorBegin();
+         elem_iter != this->GetElementIteratorEnd();
+         ++elem_iter)
+    {
+        elements_to_check.insert(elem_iter->GetIndex());
+    }
 
-            // Find distance between nodes
-            double distance_between_nodes = this->GetDistanceBetweenNodes(p_current_node->GetIndex(), p_anticlockwise_node->GetIndex());
+    std::set<unsigned> affected_elements;
+    while (!elements_to_check.empty())
+    {
+        /*
+         * Always check the lowest-indexed candidate element first. Since an element's edges can
+         * only change when a swap involves one of its nodes, and all such elements are returned to
+         * the worklist below, this finds the same short edge that a full search from the start of
+         * the mesh would.
+         */
+        unsigned elem_index = *(elements_to_check.begin());
+        elements_to_check.erase(elements_to_check.begin());
 
-            // If the nodes are too close together...
-            if (distance_between_nodes < mCellRearrangementThreshold)
+        if (this->mElements[elem_index]->IsDeleted())
+        {
+            continue;
+        }
+
+        unsigned num_elements_before_swap = this->GetNumAllElements();
+        if (CheckElementForSwapsFromShortEdges(elem_index, affected_elements))
+        {
+            /*
+             * Recheck the elements containing the swapped nodes, together with their neighbours,
+             * since an edge that was previously ignored because its nodes shared a triangular
+             * element may now need a swap.
+             */
+            for (std::set<unsigned>::iterator it = affected_elements.begin();
+                 it != affected_elements.end();
+                 ++it)
             {
-                // ...then check if any triangular elements are shared by these nodes...
-                std::set<unsigned> elements_of_node_a = p_current_node->rGetContainingElementIndices();
-                std::set<unsigned> elements_of_node_b = p_anticlockwise_node->rGetContainingElementIndices();
-
-                std::set<unsigned> shared_elements;
-                std::set_intersection(elements_of_node_a.begin(), elements_of_node_a.end(),
-                               elements_of_node_b.begin(), elements_of_node_b.end(),
-                               std::inserter(shared_elements, shared_elements.begin()));
-
-                bool both_nodes_share_triangular_element = false;
-                for (std::set<unsigned>::const_iterator it = shared_elements.begin();
-                     it != shared_elements.end();
-                     ++it)
+                VertexElement<ELEMENT_DIM, SPACE_DIM>* p_affected_element = this->mElements[*it];
+                if (!p_affected_element->IsDeleted())
                 {
-                    if (this->GetElement(*it)->GetNumNodes() <= 3)
+                    elements_to_check.insert(*it);
+                    for (unsigned local_index=0; local_index<p_affected_element->GetNumNodes(); local_index++)
                     {
-                        both_nodes_share_triangular_element = true;
-                        break;
+                        const std::set<unsigned>& r_containing_elements = p_affected_element->GetNode(local_index)->rGetContainingElementIndices();
+                        elements_to_check.insert(r_containing_elements.begin(), r_containing_elements.end());
                     }
                 }
+            }
 
-                // ...and if none are, then perform the required type of swap and halt the search, returning true
-                if (!both_nodes_share_triangular_element)
-                {
-                    IdentifySwapType(p_current_node, p_anticlockwise_node);
-                    return true;
-                }
+            // Any elements created by the swap must also be checked
+            for (unsigned new_index=num_elements_before_swap; new_index<this->GetNumAllElements(); new_index++)
+            {
+                elements_to_check.insert(new_index);
             }
         }
     }
-
-    return false;
 }
 
 template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
@@ -1018,22 +1107,53 @@ bool MutableVertexMesh<ELEMENT_DIM, SPACE_DIM>::CheckForIntersections()
     // If checking for internal intersections as well as on the boundary, then check that no nodes have overlapped any elements...
     if (mCheckForInternalIntersections)
     {
-        ///\todo Change to only loop over neighbouring elements (see #2401)
+        /*
+         * Any point inside an element lies within the smallest ball about the element's centroid
+         * that contains all of its vertices. We therefore compute each element's centroid and
+         * (squared) bounding radius once, and only call the more expensive ElementIncludesPoint()
+         * for nodes lying within this ball.
+         */
+        std::vector<unsigned> element_indices;
+        std::vector<c_vector<double, SPACE_DIM> > element_centroids;
+        std::vector<double> element_squared_radii;
+        for (typename VertexMesh<ELEMENT_DIM, SPACE_DIM>::VertexElementIterator elem_iter = this->GetElementIteratorBegin();
+             elem_iter != this->GetElementIteratorEnd();
+             ++elem_iter)
+        {
+            unsigned elem_index = elem_iter->GetIndex();
+            c_vector<double, SPACE_DIM> centroid = this->GetCentroidOfElement(elem_index);
+
+            double squared_radius = 0.0;
+            for (unsigned local_index=0; local_index<elem_iter->GetNumNodes(); local_index++)
+            {
+                c_vector<double, SPACE_DIM> centroid_to_node = this->GetVectorFromAtoB(centroid, elem_iter->GetNode(local_index)->rGetLocation());
+                squared_radius = std::max(squared_radius, inner_prod(centroid_to_node, centroid_to_node));
+            }
+
+            element_indices.push_back(elem_index);
+            element_centroids.push_back(centroid);
+            element_squared_radii.push_back(squared_radius*(1.0 + 1e-6));
+        }
+
         for (typename AbstractMesh<ELEMENT_DIM,SPACE_DIM>::NodeIterator node_iter = this->GetNodeIteratorBegin();
              node_iter != this->GetNodeIteratorEnd();
              ++node_iter)
         {
             assert(!(node_iter->IsDeleted()));
 
-            for (typename VertexMesh<ELEMENT_DIM, SPACE_DIM>::VertexElementIterator elem_iter = this->GetElementIteratorBegin();
-                 elem_iter != this->GetElementIteratorEnd();
-                 ++elem_iter)
+            for (unsigned i=0; i<element_indices.size(); i++)
             {
-                unsigned elem_index = elem_iter->GetIndex();
+                unsigned elem_index = element_indices[i];
 
                 // Check that the node is not part of this element
                 if (node_iter->rGetContainingElementIndices().count(elem_index) == 0)
                 {
+                    c_vector<double, SPACE_DIM> centroid_to_node = this->GetVectorFromAtoB(element_centroids[i], node_iter->rGetLocation());
+                    if (inner_prod(centroid_to_node, centroid_to_node) > element_squared_radii[i])
+                    {
+                        continue;
+                    }
+
                     if (this->ElementIncludesPoint(node_iter->rGetLocation(), elem_index))
                     {
                         PerformIntersectionSwap(&(*node_iter), elem_index);
@@ -1846,6 +1966,9 @@ void MutableVertexMesh<ELEMENT_DIM, SPACE_DIM>::PerformT2Swap(VertexElement<ELEM
 
     mDeletedElementIndices.push_back(rElement.GetIndex());
     rElement.MarkAsDeleted();
+
+    // The neighbouring elements now share the new central node
+    this->InvalidateElementGeometryCache();
 }
 
 template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
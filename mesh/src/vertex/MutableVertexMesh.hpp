@@ -155,6 +155,34 @@ protected:
      */
     virtual bool CheckForSwapsFromShortEdges();
 
+    /**
+     * Helper method for CheckForSwapsFromShortEdges() and PerformSwapsFromShortEdges().
+     *
+     * Check the edges of a single element, in the same way as CheckForSwapsFromShortEdges(), and
+     * perform the first required local remeshing operation found, if any.
+     *
+     * @param elementIndex the index of the element whose edges are checked
+     * @param rAffectedElements set to the indices of the elements containing either node of the
+     *     short edge, computed before the swap is performed (unchanged if no swap is performed)
+     *
+     * @return whether a swap was performed
+     */
+    bool CheckElementForSwapsFromShortEdges(unsigned elementIndex, std::set<unsigned>& rAffectedElements);
+
+    /**
+     * Helper method for ReMesh().
+     *
+     * Perform all the local remeshing operations required by short edges. This gives the same
+     * sequence of swaps as calling CheckForSwapsFromShortEdges() until it returns false, but
+     * maintains a worklist of elements that may contain short edges so that, after each swap,
+     * only the elements in the neighbourhood of the swap are rechecked rather than the whole mesh.
+     *
+     * ReMesh() performs short-edge swaps by calling this method, so a subclass that overrides
+     * CheckForSwapsFromShortEdges() must also override this method. The simplest override is
+     * to call CheckForSwapsFromShortEdges() until it returns false.
+     */
+    virtual void PerformSwapsFromShortEdges();
+
     /**
      * Helper method for ReMesh().
      *
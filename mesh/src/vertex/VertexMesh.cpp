@@ -40,7 +40,10 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
 VertexMesh<ELEMENT_DIM, SPACE_DIM>::VertexMesh(std::vector<Node<SPACE_DIM>*> nodes,
                                                std::vector<VertexElement<ELEMENT_DIM,SPACE_DIM>*> vertexElements)
-    : mpDelaunayMesh(nullptr)
+    : mpDelaunayMesh(nullptr),
+      mUseElementGeometryCache(false),
+      mNumElementGeometryCacheHits(0),
+      mNumElementGeometryCacheMisses(0)
 {
 
     // Reset member variables and clear mNodes and mElements
@@ -104,7 +107,10 @@ template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
 VertexMesh<ELEMENT_DIM, SPACE_DIM>::VertexMesh(std::vector<Node<SPACE_DIM>*> nodes,
                            std::vector<VertexElement<ELEMENT_DIM-1, SPACE_DIM>*> faces,
                            std::vector<VertexElement<ELEMENT_DIM, SPACE_DIM>*> vertexElements)
-    : mpDelaunayMesh(nullptr)
+    : mpDelaunayMesh(nullptr),
+      mUseElementGeometryCache(false),
+      mNumElementGeometryCacheHits(0),
+      mNumElementGeometryCacheMisses(0)
 {
     // Reset member variables and clear mNodes, mFaces and mElements
     Clear();
@@ -150,7 +156,10 @@ VertexMesh<ELEMENT_DIM, SPACE_DIM>::VertexMesh(std::vector<Node<SPACE_DIM>*> nod
  */
 template<>
 VertexMesh<2,2>::VertexMesh(TetrahedralMesh<2,2>& rMesh, bool isPeriodic)
-    : mpDelaunayMesh(&rMesh)
+    : mpDelaunayMesh(&rMesh),
+      mUseElementGeometryCache(false),
+      mNumElementGeometryCacheHits(0),
+      mNumElementGeometryCacheMisses(0)
 {
     //Note  !isPeriodic is not used except through polymorphic calls in rMesh
 
@@ -239,7 +248,10 @@ VertexMesh<2,2>::VertexMesh(TetrahedralMesh<2,2>& rMesh, bool isPeriodic)
  */
 template<>
 VertexMesh<3,3>::VertexMesh(TetrahedralMesh<3,3>& rMesh)
-    : mpDelaunayMesh(&rMesh)
+    : mpDelaunayMesh(&rMesh),
+      mUseElementGeometryCache(false),
+      mNumElementGeometryCacheHits(0),
+      mNumElementGeometryCacheMisses(0)
 {
     // Reset member variables and clear mNodes, mFaces and mElements
     Clear();
@@ -459,6 +471,9 @@ double VertexMesh<ELEMENT_DIM, SPACE_DIM>::GetElongationShapeFactorOfElement(uns
 
 template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
 VertexMesh<ELEMENT_DIM, SPACE_DIM>::VertexMesh()
+    : mUseElementGeometryCache(false),
+      mNumElementGeometryCacheHits(0),
+      mNumElementGeometryCacheMisses(0)
 {
     mpDelaunayMesh = nullptr;
     this->mMeshChangesDuringSimulation = false;
@@ -592,6 +607,8 @@ void VertexMesh<ELEMENT_DIM, SPACE_DIM>::Clear()
         delete this->mNodes[i];
     }
     this->mNodes.clear();
+
+    InvalidateElementGeometryCache();
 }
 
 template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
@@ -634,6 +651,22 @@ VertexElement<ELEMENT_DIM-1, SPACE_DIM>* VertexMesh<ELEMENT_DIM, SPACE_DIM>::Get
 
 template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
 c_vector<double, SPACE_DIM> VertexMesh<ELEMENT_DIM, SPACE_DIM>::GetCentroidOfElement(unsigned index)
+{
+    if (mUseElementGeometryCache)
+    {
+        if (!IsElementGeometryCached(mIsElementCentroidCached, index))
+        {
+            ResizeElementGeometryCache();
+            mCachedElementCentroids[index] = CalculateCentroidOfElement(index);
+            mIsElementCentroidCached[index] = true;
+        }
+        return mCachedElementCentroids[index];
+    }
+    return CalculateCentroidOfElement(index);
+}
+
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+c_vector<double, SPACE_DIM> VertexMesh<ELEMENT_DIM, SPACE_DIM>::CalculateCentroidOfElement(unsigned index)
 {
     VertexElement<ELEMENT_DIM, SPACE_DIM>* p_element = GetElement(index);
     unsigned num_nodes = p_element->GetNumNodes();
@@ -706,31 +739,44 @@ c_vector<double, SPACE_DIM> VertexMesh<ELEMENT_DIM, SPACE_DIM>::GetCentroidOfEle
 template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
 std::set<unsigned> VertexMesh<ELEMENT_DIM, SPACE_DIM>::GetNeighbouringNodeIndices(unsigned nodeIndex)
 {
-    // Create a set of neighbouring node indices
-    std::set<unsigned> neighbouring_node_indices;
+    std::vector<unsigned> neighbouring_node_indices;
+    GetNeighbouringNodeIndices(nodeIndex, neighbouring_node_indices);
+
+    return std::set<unsigned>(neighbouring_node_indices.begin(), neighbouring_node_indices.end());
+}
+
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+void VertexMesh<ELEMENT_DIM, SPACE_DIM>::GetNeighbouringNodeIndices(unsigned nodeIndex, std::vector<unsigned>& rNeighbouringNodeIndices)
+{
+    rNeighbouringNodeIndices.clear();
 
     // Find the indices of the elements owned by this node
-    std::set<unsigned> containing_elem_indices = this->GetNode(nodeIndex)->rGetContainingElementIndices();
+    const std::set<unsigned>& r_containing_elem_indices = this->GetNode(nodeIndex)->rGetContainingElementIndices();
 
     // Iterate over these elements
-    for (std::set<unsigned>::iterator elem_iter = containing_elem_indices.begin();
-         elem_iter != containing_elem_indices.end();
+    for (std::set<unsigned>::const_iterator elem_iter = r_containing_elem_indices.begin();
+         elem_iter != r_containing_elem_indices.end();
          ++elem_iter)
     {
+        VertexElement<ELEMENT_DIM, SPACE_DIM>* p_element = GetElement(*elem_iter);
+
         // Find the local index of this node in this element
-        unsigned local_index = GetElement(*elem_iter)->GetNodeLocalIndex(nodeIndex);
+        unsigned local_index = p_element->GetNodeLocalIndex(nodeIndex);
 
         // Find the global indices of the preceding and successive nodes in this element
-        unsigned num_nodes = GetElement(*elem_iter)->GetNumNodes();
+        unsigned num_nodes = p_element->GetNumNodes();
         unsigned previous_local_index = (local_index + num_nodes - 1)%num_nodes;
         unsigned next_local_index = (local_index + 1)%num_nodes;
 
-        // Add the global indices of these two nodes to the set of neighbouring node indices
-        neighbouring_node_indices.insert(GetElement(*elem_iter)->GetNodeGlobalIndex(previous_local_index));
-        neighbouring_node_indices.insert(GetElement(*elem_iter)->GetNodeGlobalIndex(next_local_index));
+        // Add the global indices of these two nodes to the neighbouring node indices
+        rNeighbouringNodeIndices.push_back(p_element->GetNodeGlobalIndex(previous_local_index));
+        rNeighbouringNodeIndices.push_back(p_element->GetNodeGlobalIndex(next_local_index));
     }
 
-    return neighbouring_node_indices;
+    // Sort and remove duplicates
+    std::sort(rNeighbouringNodeIndices.begin(), rNeighbouringNodeIndices.end());
+    rNeighbouringNodeIndices.erase(std::unique(rNeighbouringNodeIndices.begin(), rNeighbouringNodeIndices.end()),
+                                   rNeighbouringNodeIndices.end());
 }
 
 template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
@@ -776,35 +822,42 @@ std::set<unsigned> VertexMesh<ELEMENT_DIM, SPACE_DIM>::GetNeighbouringNodeNotAls
 template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
 std::set<unsigned> VertexMesh<ELEMENT_DIM, SPACE_DIM>::GetNeighbouringElementIndices(unsigned elementIndex)
 {
+    std::vector<unsigned> neighbouring_element_indices;
+    GetNeighbouringElementIndices(elementIndex, neighbouring_element_indices);
+
+    return std::set<unsigned>(neighbouring_element_indices.begin(), neighbouring_element_indices.end());
+}
+
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+void VertexMesh<ELEMENT_DIM, SPACE_DIM>::GetNeighbouringElementIndices(unsigned elementIndex, std::vector<unsigned>& rNeighbouringElementIndices)
+{
+    rNeighbouringElementIndices.clear();
+
     // Get a pointer to this element
     VertexElement<ELEMENT_DIM, SPACE_DIM>* p_element = this->GetElement(elementIndex);
 
-    // Create a set of neighbouring element indices
-    std::set<unsigned> neighbouring_element_indices;
-
-    // Loop over nodes owned by this element
+    // Loop over nodes owned by this element, collecting the indices of the elements owned by each node
     for (unsigned local_index=0; local_index<p_element->GetNumNodes(); local_index++)
     {
-        // Get a pointer to this node
-        Node<SPACE_DIM>* p_node = p_element->GetNode(local_index);
-
-        // Find the indices of the elements owned by this node
-        std::set<unsigned> containing_elem_indices = p_node->rGetContainingElementIndices();
-
-        // Form the union of this set with the current set of neighbouring element indices
-        std::set<unsigned> all_elements;
-        std::set_union(neighbouring_element_indices.begin(), neighbouring_element_indices.end(),
-                       containing_elem_indices.begin(), containing_elem_indices.end(),
-                       std::inserter(all_elements, all_elements.begin()));
-
-        // Update the set of neighbouring element indices
-        neighbouring_element_indices = all_elements;
+        const std::set<unsigned>& r_containing_elem_indices = p_element->GetNode(local_index)->rGetContainingElementIndices();
+        rNeighbouringElementIndices.insert(rNeighbouringElementIndices.end(),
+                                           r_containing_elem_indices.begin(),
+                                           r_containing_elem_indices.end());
     }
 
-    // Lastly remove this element's index from the set of neighbouring element indices
-    neighbouring_element_indices.erase(elementIndex);
+    // Sort and remove duplicates
+    std::sort(rNeighbouringElementIndices.begin(), rNeighbouringElementIndices.end());
+    rNeighbouringElementIndices.erase(std::unique(rNeighbouringElementIndices.begin(), rNeighbouringElementIndices.end()),
+                                      rNeighbouringElementIndices.end());
 
-    return neighbouring_element_indices;
+    // Lastly remove this element's index from the neighbouring element indices
+    std::vector<unsigned>::iterator this_elem_iter = std::lower_bound(rNeighbouringElementIndices.begin(),
+                                                                      rNeighbouringElementIndices.end(),
+                                                                      elementIndex);
+    if (this_elem_iter != rNeighbouringElementIndices.end() && *this_elem_iter == elementIndex)
+    {
+        rNeighbouringElementIndices.erase(this_elem_iter);
+    }
 }
 
 /// \cond Get Doxygen to ignore, since it's confused by these templates
@@ -1032,6 +1085,22 @@ c_vector<double, SPACE_DIM> VertexMesh<ELEMENT_DIM, SPACE_DIM>::GetVectorFromAto
 
 template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
 double VertexMesh<ELEMENT_DIM, SPACE_DIM>::GetVolumeOfElement(unsigned index)
+{
+    if (mUseElementGeometryCache)
+    {
+        if (!IsElementGeometryCached(mIsElementVolumeCached, index))
+        {
+            ResizeElementGeometryCache();
+            mCachedElementVolumes[index] = CalculateVolumeOfElement(index);
+            mIsElementVolumeCached[index] = true;
+        }
+        return mCachedElementVolumes[index];
+    }
+    return CalculateVolumeOfElement(index);
+}
+
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+double VertexMesh<ELEMENT_DIM, SPACE_DIM>::CalculateVolumeOfElement(unsigned index)
 {
     assert(SPACE_DIM == 2 || SPACE_DIM == 3);    // LCOV_EXCL_LINE - code will be removed at compile time
 
@@ -1090,6 +1159,22 @@ double VertexMesh<ELEMENT_DIM, SPACE_DIM>::GetVolumeOfElement(unsigned index)
 
 template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
 double VertexMesh<ELEMENT_DIM, SPACE_DIM>::GetSurfaceAreaOfElement(unsigned index)
+{
+    if (mUseElementGeometryCache)
+    {
+        if (!IsElementGeometryCached(mIsElementSurfaceAreaCached, index))
+        {
+            ResizeElementGeometryCache();
+            mCachedElementSurfaceAreas[index] = CalculateSurfaceAreaOfElement(index);
+            mIsElementSurfaceAreaCached[index] = true;
+        }
+        return mCachedElementSurfaceAreas[index];
+    }
+    return CalculateSurfaceAreaOfElement(index);
+}
+
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+double VertexMesh<ELEMENT_DIM, SPACE_DIM>::CalculateSurfaceAreaOfElement(unsigned index)
 {
     assert(SPACE_DIM == 2 || SPACE_DIM == 3);    // LCOV_EXCL_LINE - code will be removed at compile time
 
@@ -1309,6 +1394,22 @@ unsigned VertexMesh<ELEMENT_DIM, SPACE_DIM>::GetLocalIndexForElementEdgeClosestT
 
 template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
 c_vector<double, 3> VertexMesh<ELEMENT_DIM, SPACE_DIM>::CalculateMomentsOfElement(unsigned index)
+{
+    if (mUseElementGeometryCache)
+    {
+        if (!IsElementGeometryCached(mIsElementMomentsCached, index))
+        {
+            ResizeElementGeometryCache();
+            mCachedElementMoments[index] = CalculateMomentsOfElementWithoutCache(index);
+            mIsElementMomentsCached[index] = true;
+        }
+        return mCachedElementMoments[index];
+    }
+    return CalculateMomentsOfElementWithoutCache(index);
+}
+
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+c_vector<double, 3> VertexMesh<ELEMENT_DIM, SPACE_DIM>::CalculateMomentsOfElementWithoutCache(unsigned index)
 {
     assert(SPACE_DIM == 2);    // LCOV_EXCL_LINE - code will be removed at compile time
 
@@ -1540,6 +1641,90 @@ double VertexMesh<1,1>::CalculateAreaOfFace(VertexElement<0,1>* pFace)
 #endif
 
 
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+bool VertexMesh<ELEMENT_DIM, SPACE_DIM>::IsElementGeometryCached(const std::vector<bool>& rIsCached, unsigned index)
+{
+    if (index < rIsCached.size() && rIsCached[index])
+    {
+        mNumElementGeometryCacheHits++;
+        return true;
+    }
+    mNumElementGeometryCacheMisses++;
+    return false;
+}
+
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+void VertexMesh<ELEMENT_DIM, SPACE_DIM>::ResizeElementGeometryCache()
+{
+    unsigned num_elements = mElements.size();
+    mCachedElementVolumes.resize(num_elements);
+    mCachedElementSurfaceAreas.resize(num_elements);
+    mCachedElementCentroids.resize(num_elements);
+    mCachedElementMoments.resize(num_elements);
+    mIsElementVolumeCached.resize(num_elements, false);
+    mIsElementSurfaceAreaCached.resize(num_elements, false);
+    mIsElementCentroidCached.resize(num_elements, false);
+    mIsElementMomentsCached.resize(num_elements, false);
+}
+
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+void VertexMesh<ELEMENT_DIM, SPACE_DIM>::SetUseElementGeometryCache(bool useElementGeometryCache)
+{
+    mUseElementGeometryCache = useElementGeometryCache;
+    InvalidateElementGeometryCache();
+}
+
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+bool VertexMesh<ELEMENT_DIM, SPACE_DIM>::GetUseElementGeometryCache() const
+{
+    return mUseElementGeometryCache;
+}
+
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+void VertexMesh<ELEMENT_DIM, SPACE_DIM>::InvalidateElementGeometryCache()
+{
+    mIsElementVolumeCached.assign(mIsElementVolumeCached.size(), false);
+    mIsElementSurfaceAreaCached.assign(mIsElementSurfaceAreaCached.size(), false);
+    mIsElementCentroidCached.assign(mIsElementCentroidCached.size(), false);
+    mIsElementMomentsCached.assign(mIsElementMomentsCached.size(), false);
+}
+
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+void VertexMesh<ELEMENT_DIM, SPACE_DIM>::InvalidateElementGeometryCacheForNode(unsigned nodeIndex)
+{
+    const std::set<unsigned>& r_containing_elements = this->GetNode(nodeIndex)->rGetContainingElementIndices();
+    for (std::set<unsigned>::const_iterator iter = r_containing_elements.begin();
+         iter != r_containing_elements.end();
+         ++iter)
+    {
+        if (*iter < mIsElementVolumeCached.size())
+        {
+            mIsElementVolumeCached[*iter] = false;
+            mIsElementSurfaceAreaCached[*iter] = false;
+            mIsElementCentroidCached[*iter] = false;
+            mIsElementMomentsCached[*iter] = false;
+        }
+    }
+}
+
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+unsigned VertexMesh<ELEMENT_DIM, SPACE_DIM>::GetNumElementGeometryCacheHits() const
+{
+    return mNumElementGeometryCacheHits;
+}
+
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+unsigned VertexMesh<ELEMENT_DIM, SPACE_DIM>::GetNumElementGeometryCacheMisses() const
+{
+    return mNumElementGeometryCacheMisses;
+}
+
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+void VertexMesh<ELEMENT_DIM, SPACE_DIM>::RefreshMesh()
+{
+    InvalidateElementGeometryCache();
+}
+
 // Explicit instantiation
 template class VertexMesh<1,1>;
 template class VertexMesh<1,2>;
@@ -101,6 +101,42 @@ protected:
      */
     TetrahedralMesh<ELEMENT_DIM, SPACE_DIM>* mpDelaunayMesh;
 
+    /**
+     * Whether to cache the volume, surface area, centroid and moments of each element
+     * between calls. Defaults to false.
+     */
+    bool mUseElementGeometryCache;
+
+    /** Cached element volumes, indexed by element index. */
+    std::vector<double> mCachedElementVolumes;
+
+    /** Cached element surface areas, indexed by element index. */
+    std::vector<double> mCachedElementSurfaceAreas;
+
+    /** Cached element centroids, indexed by element index. */
+    std::vector<c_vector<double, SPACE_DIM> > mCachedElementCentroids;
+
+    /** Cached element moments (Ixx, Iyy, Ixy), indexed by element index. */
+    std::vector<c_vector<double, 3> > mCachedElementMoments;
+
+    /** Whether each entry of mCachedElementVolumes is valid. */
+    std::vector<bool> mIsElementVolumeCached;
+
+    /** Whether each entry of mCachedElementSurfaceAreas is valid. */
+    std::vector<bool> mIsElementSurfaceAreaCached;
+
+    /** Whether each entry of mCachedElementCentroids is valid. */
+    std::vector<bool> mIsElementCentroidCached;
+
+    /** Whether each entry of mCachedElementMoments is valid. */
+    std::vector<bool> mIsElementMomentsCached;
+
+    /** The number of element geometry queries answered from the cache. */
+    unsigned mNumElementGeometryCacheHits;
+
+    /** The number of element geometry queries that required a computation. */
+    unsigned mNumElementGeometryCacheMisses;
+
     /**
      * Solve node mapping method. This overridden method is required
      * as it is pure virtual in the base class.
@@ -170,6 +206,60 @@ protected:
      */
     unsigned GetLocalIndexForElementEdgeClosestToPoint(const c_vector<double, SPACE_DIM>& rTestPoint, unsigned elementIndex);
 
+    /**
+     * Helper method for the element geometry cache. Check whether a cached quantity is
+     * valid for a given element, updating the hit and miss counters accordingly.
+     *
+     * @param rIsCached the validity flags for the quantity
+     * @param index the global index of the element
+     *
+     * @return whether the cached value may be used
+     */
+    bool IsElementGeometryCached(const std::vector<bool>& rIsCached, unsigned index);
+
+    /**
+     * Helper method for the element geometry cache. Resize the cache so that it has an
+     * entry for every element, marking any new entries as invalid.
+     */
+    void ResizeElementGeometryCache();
+
+    /**
+     * Compute the volume of an element without using the cache. Called by GetVolumeOfElement().
+     *
+     * @param index  the global index of a specified vertex element
+     *
+     * @return the volume of the element
+     */
+    double CalculateVolumeOfElement(unsigned index);
+
+    /**
+     * Compute the surface area of an element without using the cache. Called by
+     * GetSurfaceAreaOfElement().
+     *
+     * @param index  the global index of a specified vertex element
+     *
+     * @return the surface area of the element
+     */
+    double CalculateSurfaceAreaOfElement(unsigned index);
+
+    /**
+     * Compute the centroid of an element without using the cache. Called by GetCentroidOfElement().
+     *
+     * @param index  the global index of a specified vertex element
+     *
+     * @return the centroid of the element
+     */
+    c_vector<double, SPACE_DIM> CalculateCentroidOfElement(unsigned index);
+
+    /**
+     * Compute the moments of an element without using the cache. Called by CalculateMomentsOfElement().
+     *
+     * @param index  the global index of a specified vertex element
+     *
+     * @return (Ixx,Iyy,Ixy).
+     */
+    c_vector<double, 3> CalculateMomentsOfElementWithoutCache(unsigned index);
+
     /** Needed for serialization. */
     friend class boost::serialization::access;
 
@@ -366,6 +456,56 @@ public:
      */
     unsigned GetRosetteRankOfElement(unsigned index);
 
+    /**
+     * Set whether to cache the volume, surface area, centroid and moments of each element.
+     *
+     * When switched on, each quantity is computed the first time it is requested for an
+     * element and then reused until the cache is invalidated. The cache for an element is
+     * invalidated when one of its nodes is moved using SetNode(), and the whole cache is
+     * invalidated by any change to the mesh topology (e.g. ReMesh() or DivideElement())
+     * and by Translate(), Scale() and Rotate(). Node locations altered directly through
+     * rGetModifiableLocation() are not detected, so InvalidateElementGeometryCache() must
+     * be called after any such change.
+     *
+     * OffLatticeSimulation switches the cache on for vertex-based cell populations.
+     *
+     * @param useElementGeometryCache whether to use the cache
+     */
+    void SetUseElementGeometryCache(bool useElementGeometryCache);
+
+    /**
+     * @return mUseElementGeometryCache
+     */
+    bool GetUseElementGeometryCache() const;
+
+    /**
+     * Mark the cached geometry of every element as invalid.
+     */
+    void InvalidateElementGeometryCache();
+
+    /**
+     * Mark the cached geometry of every element containing a given node as invalid.
+     *
+     * @param nodeIndex the global index of the node
+     */
+    void InvalidateElementGeometryCacheForNode(unsigned nodeIndex);
+
+    /**
+     * @return the number of element geometry queries answered from the cache
+     */
+    unsigned GetNumElementGeometryCacheHits() const;
+
+    /**
+     * @return the number of element geometry queries that required a computation
+     */
+    unsigned GetNumElementGeometryCacheMisses() const;
+
+    /**
+     * Overridden RefreshMesh() method. This is called by Translate(), Scale() and
+     * Rotate() after the nodes have been moved, and invalidates the element geometry cache.
+     */
+    virtual void RefreshMesh();
+
     /**
      * Overridden GetVectorFromAtoB() method. Returns a vector between two points in space.
      *
@@ -562,6 +702,16 @@ public:
      */
     std::set<unsigned> GetNeighbouringNodeIndices(unsigned nodeIndex);
 
+    /**
+     * Given a node, find the indices of its neighbouring nodes, in increasing order.
+     * This avoids constructing a set, and does not allocate memory if the vector
+     * is reused and already large enough.
+     *
+     * @param nodeIndex global index of the node
+     * @param rNeighbouringNodeIndices vector to be filled with the neighbouring node indices
+     */
+    void GetNeighbouringNodeIndices(unsigned nodeIndex, std::vector<unsigned>& rNeighbouringNodeIndices);
+
     /**
      * Given a node and one of its containing elements, find a set containing
      * the indices of those neighbouring node(s) that are NOT also in the element.
@@ -584,6 +734,16 @@ public:
      */
     std::set<unsigned> GetNeighbouringElementIndices(unsigned elementIndex);
 
+    /**
+     * Given an element, find the indices of its neighbouring elements, in increasing order.
+     * This avoids constructing a set, and does not allocate memory if the vector
+     * is reused and already large enough.
+     *
+     * @param elementIndex global index of the element
+     * @param rNeighbouringElementIndices vector to be filled with the neighbouring element indices
+     */
+    void GetNeighbouringElementIndices(unsigned elementIndex, std::vector<unsigned>& rNeighbouringElementIndices);
+
     /**
      * A smart iterator over the elements in the mesh.
      *
@@ -1177,6 +1177,50 @@ public:
         TS_ASSERT_DELTA(mesh.GetNode(2u)->rGetLocation()[2], 0.0, 1e-6);
     }
 
+    void TestElementSpatialIndexIsClearedWhenMeshChanges()
+    {
+        MutableMesh<2,2> mesh;
+        mesh.ConstructRegularSlabMesh(1.0, 4.0, 4.0);
+
+        // Moving a node changes the bounding boxes of the elements containing it
+        mesh.SetUpElementSpatialIndex();
+        ChastePoint<2> new_location(1.2, 1.1);
+        mesh.SetNode(6, new_location);
+        TS_ASSERT_EQUALS(mesh.IsElementSpatialIndexSetUp(), false);
+
+        mesh.SetUpElementSpatialIndex();
+        mesh.DeleteNode(12);
+        TS_ASSERT_EQUALS(mesh.IsElementSpatialIndexSetUp(), false);
+
+        mesh.SetUpElementSpatialIndex();
+        mesh.AddNode(new Node<2>(0, false, 2.5, 2.5));
+        TS_ASSERT_EQUALS(mesh.IsElementSpatialIndexSetUp(), false);
+
+        mesh.SetUpElementSpatialIndex();
+        mesh.ReMesh();
+        TS_ASSERT_EQUALS(mesh.IsElementSpatialIndexSetUp(), false);
+
+        // An index set up on the new elements gives the same results as an exhaustive search
+        std::vector<unsigned> exhaustive_results;
+        for (unsigned i=0; i<=16; i++)
+        {
+            for (unsigned j=0; j<=16; j++)
+            {
+                ChastePoint<2> point(0.25*i, 0.25*j);
+                exhaustive_results.push_back(mesh.GetContainingElementIndex(point));
+            }
+        }
+        mesh.SetUpElementSpatialIndex();
+        for (unsigned i=0; i<=16; i++)
+        {
+            for (unsigned j=0; j<=16; j++)
+            {
+                ChastePoint<2> point(0.25*i, 0.25*j);
+                TS_ASSERT_EQUALS(mesh.GetContainingElementIndex(point), exhaustive_results[17*i + j]);
+            }
+        }
+    }
+
     void TestArchiving()
     {
         FileFinder archive_dir("archive_mutable_mesh", RelativeTo::ChasteTestOutput);
@@ -1057,6 +1057,68 @@ public:
             }
         }
     }
+
+    void TestReorderNodesAlongSpaceFillingCurve()
+    {
+        EXIT_IF_PARALLEL;
+
+        // Create nodes on a 4x4 grid, numbered in a deliberately scrambled order
+        std::vector<Node<2>*> nodes;
+        unsigned scramble[16] = {5, 12, 0, 9, 14, 3, 7, 10, 1, 15, 6, 11, 2, 13, 8, 4};
+        for (unsigned i=0; i<16; i++)
+        {
+            unsigned position = scramble[i];
+            nodes.push_back(new Node<2>(i, false, (double)(position%4), (double)(position/4)));
+        }
+
+        NodesOnlyMesh<2> mesh;
+        mesh.ConstructNodesWithoutMesh(nodes, 1.5);
+
+        // Record the location of each global index
+        std::map<unsigned, c_vector<double, 2> > old_locations;
+        for (AbstractMesh<2,2>::NodeIterator node_iter = mesh.GetNodeIteratorBegin();
+             node_iter != mesh.GetNodeIteratorEnd();
+             ++node_iter)
+        {
+            old_locations[node_iter->GetIndex()] = node_iter->rGetLocation();
+        }
+
+        mesh.ReorderNodesAlongSpaceFillingCurve();
+
+        // Global indices and locations are unchanged
+        TS_ASSERT_EQUALS(mesh.GetNumNodes(), 16u);
+        for (std::map<unsigned, c_vector<double, 2> >::iterator it = old_locations.begin();
+             it != old_locations.end();
+             ++it)
+        {
+            TS_ASSERT_DELTA(mesh.GetNode(it->first)->rGetLocation()[0], it->second[0], 1e-12);
+            TS_ASSERT_DELTA(mesh.GetNode(it->first)->rGetLocation()[1], it->second[1], 1e-12);
+            TS_ASSERT_EQUALS(mesh.GetNode(it->first)->GetIndex(), it->first);
+        }
+
+        // Nodes are now stored in Z-order: (0,0), (1,0), (0,1), (1,1), (2,0), ...
+        double expected_x[16] = {0, 1, 0, 1, 2, 3, 2, 3, 0, 1, 0, 1, 2, 3, 2, 3};
+        double expected_y[16] = {0, 0, 1, 1, 0, 0, 1, 1, 2, 2, 3, 3, 2, 2, 3, 3};
+        for (unsigned i=0; i<16; i++)
+        {
+            TS_ASSERT_DELTA(mesh.mNodes[i]->rGetLocation()[0], expected_x[i], 1e-12);
+            TS_ASSERT_DELTA(mesh.mNodes[i]->rGetLocation()[1], expected_y[i], 1e-12);
+            TS_ASSERT_EQUALS(mesh.SolveNodeMapping(mesh.mNodes[i]->GetIndex()), i);
+        }
+
+        // The nodes can still be put in boxes
+        mesh.UpdateBoxCollection();
+
+        // Reordering is not permitted while there are deleted nodes awaiting ReMesh()
+        mesh.DeleteNodePriorToReMesh(0);
+        TS_ASSERT_THROWS_THIS(mesh.ReorderNodesAlongSpaceFillingCurve(),
+                              "Deleted nodes must be removed by calling ReMesh() before the nodes can be reordered");
+
+        for (unsigned i=0; i<nodes.size(); i++)
+        {
+            delete nodes[i];
+        }
+    }
 };
 
 #endif /*TESTNODESONLYMESH_HPP_*/
@@ -38,6 +38,7 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <cxxtest/TestSuite.h>
 #include "CheckpointArchiveTypes.hpp"
+#include <algorithm>
 #include <fstream>
 #include <cmath>
 #include <vector>
@@ -1439,6 +1440,78 @@ public:
         TS_ASSERT_EQUALS(mesh.GetNearestNodeIndex(point3), 665u); // Point is exactly at node 665
     }
 
+    void TestPointInMeshWithElementSpatialIndex()
+    {
+        TrianglesMeshReader<3,3> mesh_reader("mesh/test/data/3D_0_to_1mm_6000_elements");
+        TetrahedralMesh<3,3> mesh;
+        mesh.ConstructFromMeshReader(mesh_reader);
+
+        TS_ASSERT_EQUALS(mesh.IsElementSpatialIndexSetUp(), false);
+        mesh.SetUpElementSpatialIndex();
+        TS_ASSERT_EQUALS(mesh.IsElementSpatialIndexSetUp(), true);
+
+        // The results should be identical to those of an exhaustive search (see TestPointinMesh3D)
+        ChastePoint<3> point1(0.051, 0.051,0.051);
+        ChastePoint<3> point2(0.2, 0.2, 0.2);
+        ChastePoint<3> point3(0.050000000000000003, 0.050000000000000003, 0.050000000000000003);
+
+        const std::vector<unsigned>& r_candidates = mesh.rGetCandidateContainingElementIndices(point1);
+        TS_ASSERT_LESS_THAN(r_candidates.size(), mesh.GetNumElements());
+        TS_ASSERT(std::find(r_candidates.begin(), r_candidates.end(), 2992u) != r_candidates.end());
+
+        TS_ASSERT_EQUALS(mesh.GetContainingElementIndex(point1), 2992u);
+        TS_ASSERT_THROWS_CONTAINS(mesh.GetContainingElementIndex(point2),"is not in mesh");
+        TS_ASSERT_EQUALS(mesh.GetContainingElementIndex(point3), 2044u);
+
+        TS_ASSERT_EQUALS(mesh.GetContainingElementIndexWithInitialGuess(point1, 0), 2992u);
+        TS_ASSERT_EQUALS(mesh.GetContainingElementIndexWithInitialGuess(point1, 2992), 2992u);
+        TS_ASSERT_EQUALS(mesh.GetContainingElementIndexWithInitialGuess(point1, 5999), 2992u);
+        TS_ASSERT_EQUALS(mesh.GetContainingElementIndexWithInitialGuess(point3, 2000), 2044u);
+        TS_ASSERT_EQUALS(mesh.GetContainingElementIndexWithInitialGuess(point3, 2045), 2047u);
+        TS_ASSERT_EQUALS(mesh.GetContainingElementIndexWithInitialGuess(point3, 3025), 3026u);
+        TS_ASSERT_EQUALS(mesh.GetContainingElementIndexWithInitialGuess(point3, 3027), 2044u);
+        TS_ASSERT_THROWS_CONTAINS(mesh.GetContainingElementIndexWithInitialGuess(point2, 0), "not in mesh - all elements tested");
+        TS_ASSERT_THROWS_CONTAINS(mesh.GetContainingElementIndexWithInitialGuess(point3, 0, true), "not in mesh - all elements tested");
+
+        // The index is rebuilt when the mesh is translated
+        c_vector<double, 3> shift = scalar_vector<double>(3, 1.0);
+        mesh.Translate(shift);
+        TS_ASSERT_EQUALS(mesh.IsElementSpatialIndexSetUp(), true);
+        ChastePoint<3> shifted_point1(1.051, 1.051, 1.051);
+        TS_ASSERT_EQUALS(mesh.GetContainingElementIndex(shifted_point1), 2992u);
+        TS_ASSERT_THROWS_CONTAINS(mesh.GetContainingElementIndex(point1),"is not in mesh");
+
+        // Compare with an exhaustive search on a regular 2D mesh, where many points lie on element edges
+        TetrahedralMesh<2,2> mesh_2d;
+        mesh_2d.ConstructRegularSlabMesh(1.0, 10.0, 6.0);
+        std::vector<unsigned> exhaustive_results;
+        for (unsigned i=0; i<=40; i++)
+        {
+            for (unsigned j=0; j<=24; j++)
+            {
+                ChastePoint<2> point(0.25*i, 0.25*j);
+                exhaustive_results.push_back(mesh_2d.GetContainingElementIndex(point));
+                exhaustive_results.push_back(mesh_2d.GetContainingElementIndexWithInitialGuess(point, (7*i + j)%mesh_2d.GetNumElements()));
+            }
+        }
+
+        mesh_2d.SetUpElementSpatialIndex();
+        unsigned result_index = 0;
+        for (unsigned i=0; i<=40; i++)
+        {
+            for (unsigned j=0; j<=24; j++)
+            {
+                ChastePoint<2> point(0.25*i, 0.25*j);
+                TS_ASSERT_EQUALS(mesh_2d.GetContainingElementIndex(point), exhaustive_results[result_index++]);
+                TS_ASSERT_EQUALS(mesh_2d.GetContainingElementIndexWithInitialGuess(point, (7*i + j)%mesh_2d.GetNumElements()),
+                                 exhaustive_results[result_index++]);
+            }
+        }
+
+        mesh_2d.ClearElementSpatialIndex();
+        TS_ASSERT_EQUALS(mesh_2d.IsElementSpatialIndexSetUp(), false);
+    }
+
     void TestFloatingPointIn3D()
     {
         // There's some weird failing behaviour in the refined mesh test.
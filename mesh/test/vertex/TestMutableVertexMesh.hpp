@@ -376,6 +376,88 @@ public:
         TS_ASSERT_DELTA(point3[1], 1.9, 1e-6);
     }
 
+    void TestElementGeometryCache()
+    {
+        // Create two identical meshes, only one of which caches element geometry
+        HoneycombVertexMeshGenerator generator(3, 3);
+        MutableVertexMesh<2,2>* p_mesh = generator.GetMesh();
+        HoneycombVertexMeshGenerator generator2(3, 3);
+        MutableVertexMesh<2,2>* p_cached_mesh = generator2.GetMesh();
+
+        TS_ASSERT_EQUALS(p_cached_mesh->GetUseElementGeometryCache(), false);
+        p_cached_mesh->SetUseElementGeometryCache(true);
+        TS_ASSERT_EQUALS(p_cached_mesh->GetUseElementGeometryCache(), true);
+
+        // The first query of each quantity is a miss, and later queries are hits
+        TS_ASSERT_DELTA(p_cached_mesh->GetVolumeOfElement(4), p_mesh->GetVolumeOfElement(4), 1e-12);
+        TS_ASSERT_EQUALS(p_cached_mesh->GetNumElementGeometryCacheMisses(), 1u);
+        TS_ASSERT_EQUALS(p_cached_mesh->GetNumElementGeometryCacheHits(), 0u);
+        TS_ASSERT_DELTA(p_cached_mesh->GetVolumeOfElement(4), p_mesh->GetVolumeOfElement(4), 1e-12);
+        TS_ASSERT_EQUALS(p_cached_mesh->GetNumElementGeometryCacheHits(), 1u);
+
+        // Moments use the centroid, which is then cached too
+        c_vector<double, 3> moments = p_cached_mesh->CalculateMomentsOfElement(4);
+        TS_ASSERT_EQUALS(p_cached_mesh->GetNumElementGeometryCacheMisses(), 3u);
+        c_vector<double, 2> centroid = p_cached_mesh->GetCentroidOfElement(4);
+        TS_ASSERT_EQUALS(p_cached_mesh->GetNumElementGeometryCacheHits(), 2u);
+        for (unsigned i=0; i<2; i++)
+        {
+            TS_ASSERT_DELTA(centroid[i], p_mesh->GetCentroidOfElement(4)[i], 1e-12);
+        }
+        for (unsigned i=0; i<3; i++)
+        {
+            TS_ASSERT_DELTA(moments[i], p_mesh->CalculateMomentsOfElement(4)[i], 1e-12);
+        }
+
+        // Moving a node using SetNode() invalidates the cache for the elements containing it
+        unsigned node_index = p_mesh->GetElement(4)->GetNodeGlobalIndex(0);
+        ChastePoint<2> point = p_mesh->GetNode(node_index)->GetPoint();
+        point.SetCoordinate(0, point[0] + 0.1);
+        p_mesh->SetNode(node_index, point);
+        p_cached_mesh->SetNode(node_index, point);
+
+        for (VertexMesh<2,2>::VertexElementIterator elem_iter = p_mesh->GetElementIteratorBegin();
+             elem_iter != p_mesh->GetElementIteratorEnd();
+             ++elem_iter)
+        {
+            unsigned elem_index = elem_iter->GetIndex();
+            TS_ASSERT_DELTA(p_cached_mesh->GetVolumeOfElement(elem_index), p_mesh->GetVolumeOfElement(elem_index), 1e-12);
+            TS_ASSERT_DELTA(p_cached_mesh->GetSurfaceAreaOfElement(elem_index), p_mesh->GetSurfaceAreaOfElement(elem_index), 1e-12);
+            TS_ASSERT_DELTA(p_cached_mesh->GetCentroidOfElement(elem_index)[0], p_mesh->GetCentroidOfElement(elem_index)[0], 1e-12);
+        }
+
+        // Dividing an element invalidates the whole cache
+        p_mesh->DivideElementAlongShortAxis(p_mesh->GetElement(4));
+        p_cached_mesh->DivideElementAlongShortAxis(p_cached_mesh->GetElement(4));
+        TS_ASSERT_EQUALS(p_cached_mesh->GetNumElements(), p_mesh->GetNumElements());
+        for (unsigned elem_index=0; elem_index<p_mesh->GetNumElements(); elem_index++)
+        {
+            TS_ASSERT_DELTA(p_cached_mesh->GetVolumeOfElement(elem_index), p_mesh->GetVolumeOfElement(elem_index), 1e-12);
+            TS_ASSERT_DELTA(p_cached_mesh->GetSurfaceAreaOfElement(elem_index), p_mesh->GetSurfaceAreaOfElement(elem_index), 1e-12);
+        }
+
+        // Translating, scaling and rotating the mesh invalidate the whole cache
+        p_mesh->Translate(1.0, 2.0);
+        p_cached_mesh->Translate(1.0, 2.0);
+        TS_ASSERT_DELTA(p_cached_mesh->GetCentroidOfElement(4)[1], p_mesh->GetCentroidOfElement(4)[1], 1e-12);
+
+        p_mesh->Scale(2.0, 0.5);
+        p_cached_mesh->Scale(2.0, 0.5);
+        TS_ASSERT_DELTA(p_cached_mesh->GetCentroidOfElement(4)[0], p_mesh->GetCentroidOfElement(4)[0], 1e-12);
+        TS_ASSERT_DELTA(p_cached_mesh->GetSurfaceAreaOfElement(4), p_mesh->GetSurfaceAreaOfElement(4), 1e-12);
+
+        p_mesh->Rotate(0.3);
+        p_cached_mesh->Rotate(0.3);
+        for (unsigned i=0; i<2; i++)
+        {
+            TS_ASSERT_DELTA(p_cached_mesh->GetCentroidOfElement(4)[i], p_mesh->GetCentroidOfElement(4)[i], 1e-12);
+        }
+        for (unsigned i=0; i<3; i++)
+        {
+            TS_ASSERT_DELTA(p_cached_mesh->CalculateMomentsOfElement(4)[i], p_mesh->CalculateMomentsOfElement(4)[i], 1e-12);
+        }
+    }
+
     void TestAddNodeAndReMesh()
     {
         // Create mesh
@@ -46,6 +46,44 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 //This test is always run sequentially (never in parallel)
 #include "FakePetscSetup.hpp"
 
+/**
+ * A mutable vertex mesh that counts the calls to CheckForSwapsFromShortEdges(), and
+ * overrides PerformSwapsFromShortEdges() so that ReMesh() goes through it.
+ */
+class MutableVertexMeshWithCountedSwapChecks : public MutableVertexMesh<2,2>
+{
+private:
+
+    /** The number of calls to CheckForSwapsFromShortEdges(). */
+    unsigned mNumSwapChecks;
+
+public:
+
+    MutableVertexMeshWithCountedSwapChecks()
+        : MutableVertexMesh<2,2>(),
+          mNumSwapChecks(0)
+    {
+    }
+
+    bool CheckForSwapsFromShortEdges()
+    {
+        mNumSwapChecks++;
+        return MutableVertexMesh<2,2>::CheckForSwapsFromShortEdges();
+    }
+
+    void PerformSwapsFromShortEdges()
+    {
+        while (CheckForSwapsFromShortEdges())
+        {
+        }
+    }
+
+    unsigned GetNumSwapChecks()
+    {
+        return mNumSwapChecks;
+    }
+};
+
 class TestMutableVertexMeshReMesh : public CxxTest::TestSuite
 {
 public:
@@ -1181,6 +1219,72 @@ public:
         TS_ASSERT(comparer2.CompareFiles());
     }
 
+    void TestReMeshUsesOverriddenPerformSwapsFromShortEdges()
+    {
+        VertexMeshReader<2,2> mesh_reader("cell_based/test/data/TestMutableVertexMesh/vertex_remesh_T1");
+        MutableVertexMeshWithCountedSwapChecks vertex_mesh;
+        vertex_mesh.ConstructFromMeshReader(mesh_reader);
+        vertex_mesh.SetCellRearrangementThreshold(0.1);
+
+        vertex_mesh.ReMesh();
+
+        // ReMesh() should have performed the swaps through the overridden methods
+        TS_ASSERT_LESS_THAN(1u, vertex_mesh.GetNumSwapChecks());
+        TS_ASSERT_EQUALS(vertex_mesh.MutableVertexMesh<2,2>::CheckForSwapsFromShortEdges(), false);
+    }
+
+    void TestPerformSwapsFromShortEdgesMatchesRepeatedSearch()
+    {
+        // Read in two copies of a vertex mesh containing several short edges (see the previous test)
+        VertexMeshReader<2,2> mesh_reader("cell_based/test/data/TestMutableVertexMesh/vertex_remesh_T1");
+        MutableVertexMesh<2,2> mesh_full_search;
+        mesh_full_search.ConstructFromMeshReader(mesh_reader);
+        mesh_full_search.SetCellRearrangementThreshold(0.1);
+
+        mesh_reader.Reset();
+        MutableVertexMesh<2,2> mesh_worklist;
+        mesh_worklist.ConstructFromMeshReader(mesh_reader);
+        mesh_worklist.SetCellRearrangementThreshold(0.1);
+
+        // Perform the swaps by repeatedly searching the whole mesh...
+        unsigned num_swaps = 0;
+        while (mesh_full_search.CheckForSwapsFromShortEdges())
+        {
+            num_swaps++;
+        }
+        TS_ASSERT_LESS_THAN(0u, num_swaps);
+
+        // ...and by using a worklist of elements
+        mesh_worklist.PerformSwapsFromShortEdges();
+
+        // No short edges should remain
+        TS_ASSERT_EQUALS(mesh_worklist.CheckForSwapsFromShortEdges(), false);
+
+        // The two meshes should be identical
+        TS_ASSERT_EQUALS(mesh_worklist.GetNumNodes(), mesh_full_search.GetNumNodes());
+        TS_ASSERT_EQUALS(mesh_worklist.GetNumElements(), mesh_full_search.GetNumElements());
+        for (unsigned node_index=0; node_index<mesh_full_search.GetNumNodes(); node_index++)
+        {
+            for (unsigned i=0; i<2; i++)
+            {
+                TS_ASSERT_DELTA(mesh_worklist.GetNode(node_index)->rGetLocation()[i],
+                                mesh_full_search.GetNode(node_index)->rGetLocation()[i], 1e-12);
+            }
+            TS_ASSERT_EQUALS(mesh_worklist.GetNode(node_index)->IsBoundaryNode(),
+                             mesh_full_search.GetNode(node_index)->IsBoundaryNode());
+        }
+        for (unsigned elem_index=0; elem_index<mesh_full_search.GetNumElements(); elem_index++)
+        {
+            VertexElement<2,2>* p_element = mesh_full_search.GetElement(elem_index);
+            TS_ASSERT_EQUALS(mesh_worklist.GetElement(elem_index)->GetNumNodes(), p_element->GetNumNodes());
+            for (unsigned local_index=0; local_index<p_element->GetNumNodes(); local_index++)
+            {
+                TS_ASSERT_EQUALS(mesh_worklist.GetElement(elem_index)->GetNodeGlobalIndex(local_index),
+                                 p_element->GetNodeGlobalIndex(local_index));
+            }
+        }
+    }
+
     void TestReMeshExceptionWhenNonBoundaryNodesAreContainedOnlyInTwoElements()
     {
         /*
@@ -846,6 +846,16 @@ public:
         expected_element_neighbours.insert(2);
 
         TS_ASSERT_EQUALS(element_neighbours, expected_element_neighbours);
+
+        // Check the versions that fill a vector give the same indices, in increasing order
+        std::vector<unsigned> neighbours;
+        mesh.GetNeighbouringNodeIndices(6, neighbours);
+        TS_ASSERT_EQUALS(neighbours.size(), 3u);
+        TS_ASSERT(std::equal(neighbours.begin(), neighbours.end(), expected_node_neighbours.begin()));
+
+        mesh.GetNeighbouringElementIndices(0, neighbours);
+        TS_ASSERT_EQUALS(neighbours.size(), 2u);
+        TS_ASSERT(std::equal(neighbours.begin(), neighbours.end(), expected_element_neighbours.begin()));
     }
 
     void TestGetRosetteRankOfElement()
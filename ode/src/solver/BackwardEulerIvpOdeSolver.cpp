@@ -35,7 +35,9 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 
 #include "BackwardEulerIvpOdeSolver.hpp"
+#include "Exception.hpp"
 #include <cmath>
+#include <typeinfo>
 
 void BackwardEulerIvpOdeSolver::ComputeResidual(AbstractOdeSystem* pAbstractOdeSystem,
                                                 double timeStep,
@@ -72,6 +74,14 @@ void BackwardEulerIvpOdeSolver::ComputeJacobian(AbstractOdeSystem* pAbstractOdeS
             = static_cast<AbstractOdeSystemWithAnalyticJacobian*>(pAbstractOdeSystem);
         p_ode_system->AnalyticJacobian(rCurrentGuess, mJacobian, time, timeStep);
     }
+    else if (mUseColouredNumericalJacobian && !mColumnsOfColour.empty())
+    {
+        ComputeColouredNumericalJacobian(pAbstractOdeSystem,
+                                         timeStep,
+                                         time,
+                                         rCurrentYValues,
+                                         rCurrentGuess);
+    }
     else
     {
         ComputeNumericalJacobian(pAbstractOdeSystem,
@@ -79,6 +89,14 @@ void BackwardEulerIvpOdeSolver::ComputeJacobian(AbstractOdeSystem* pAbstractOdeS
                                  time,
                                  rCurrentYValues,
                                  rCurrentGuess);
+        if (mUseColouredNumericalJacobian)
+        {
+            DetectJacobianSparsity(pAbstractOdeSystem,
+                                   timeStep,
+                                   time,
+                                   rCurrentYValues,
+                                   rCurrentGuess);
+        }
     }
 }
 
@@ -89,6 +107,10 @@ void BackwardEulerIvpOdeSolver::SolveLinearSystem()
     {
         for (unsigned ii=i+1; ii<mSizeOfOdeSystem; ii++)
         {
+            if (mJacobian[ii][i] == 0.0)
+            {
+                continue; // Nothing to eliminate; common when the Jacobian is sparse
+            }
             fact = mJacobian[ii][i]/mJacobian[i][i];
             for (unsigned j=i; j<mSizeOfOdeSystem; j++)
             {
@@ -162,6 +184,183 @@ void BackwardEulerIvpOdeSolver::ComputeNumericalJacobian(AbstractOdeSystem* pAbs
             mJacobian[i][global_column] = one_over_eps*(residual_perturbed[i] - residual[i]);
         }
     }
+
+    // Leave the unperturbed residual for the Newton update
+    for (unsigned i=0; i<mSizeOfOdeSystem; i++)
+    {
+        mResidual[i] = residual[i];
+    }
+}
+
+void BackwardEulerIvpOdeSolver::ComputeColouredNumericalJacobian(AbstractOdeSystem* pAbstractOdeSystem,
+                                                                 double timeStep,
+                                                                 double time,
+                                                                 std::vector<double>& rCurrentYValues,
+                                                                 std::vector<double>& rCurrentGuess)
+{
+    std::vector<double> residual(mSizeOfOdeSystem);
+    std::vector<double> guess_perturbed(rCurrentGuess);
+
+    double epsilon = mNumericalJacobianEpsilon;
+    double one_over_eps = 1.0/epsilon;
+
+    ComputeResidual(pAbstractOdeSystem, timeStep, time, rCurrentYValues, rCurrentGuess);
+    for (unsigned i=0; i<mSizeOfOdeSystem; i++)
+    {
+        residual[i] = mResidual[i];
+    }
+
+    for (unsigned colour=0; colour<mColumnsOfColour.size(); colour++)
+    {
+        const std::vector<unsigned>& r_columns = mColumnsOfColour[colour];
+
+        // Perturb every column of this colour at once: they don't share any rows
+        for (unsigned k=0; k<r_columns.size(); k++)
+        {
+            guess_perturbed[r_columns[k]] += epsilon;
+        }
+
+        ComputeResidual(pAbstractOdeSystem, timeStep, time, rCurrentYValues, guess_perturbed);
+
+        for (unsigned k=0; k<r_columns.size(); k++)
+        {
+            const unsigned global_column = r_columns[k];
+            const std::vector<unsigned>& r_rows = mJacobianColumnRows[global_column];
+            for (unsigned r=0; r<r_rows.size(); r++)
+            {
+                const unsigned i = r_rows[r];
+                mJacobian[i][global_column] = one_over_eps*(mResidual[i] - residual[i]);
+            }
+            guess_perturbed[global_column] = rCurrentGuess[global_column];
+        }
+    }
+
+    // Leave the unperturbed residual for the Newton update
+    for (unsigned i=0; i<mSizeOfOdeSystem; i++)
+    {
+        mResidual[i] = residual[i];
+    }
+}
+
+void BackwardEulerIvpOdeSolver::DetectJacobianSparsity(AbstractOdeSystem* pAbstractOdeSystem,
+                                                       double timeStep,
+                                                       double time,
+                                                       std::vector<double>& rCurrentYValues,
+                                                       std::vector<double>& rCurrentGuess)
+{
+    // Start from the diagonal, any pattern found before, and the Jacobian at the current guess
+    std::vector<std::vector<bool> > non_zero(mSizeOfOdeSystem, std::vector<bool>(mSizeOfOdeSystem, false));
+    for (unsigned j=0; j<mSizeOfOdeSystem; j++)
+    {
+        non_zero[j][j] = true;
+        if (j < mJacobianColumnRows.size())
+        {
+            for (unsigned r=0; r<mJacobianColumnRows[j].size(); r++)
+            {
+                non_zero[mJacobianColumnRows[j][r]][j] = true;
+            }
+        }
+        for (unsigned i=0; i<mSizeOfOdeSystem; i++)
+        {
+            if (mJacobian[i][j] != 0.0)
+            {
+                non_zero[i][j] = true;
+            }
+        }
+    }
+
+    // An entry can happen to vanish at the current guess (e.g. d(y0*y1)/dy0 when y1 is zero),
+    // so add the entries that are non-zero at a few nearby states, perturbing each variable by a
+    // different relative amount.  The Jacobian and residual at the current guess are kept.
+    std::vector<double> jacobian(mSizeOfOdeSystem*mSizeOfOdeSystem);
+    std::vector<double> residual(mResidual, mResidual+mSizeOfOdeSystem);
+    for (unsigned i=0; i<mSizeOfOdeSystem; i++)
+    {
+        for (unsigned j=0; j<mSizeOfOdeSystem; j++)
+        {
+            jacobian[i*mSizeOfOdeSystem + j] = mJacobian[i][j];
+        }
+    }
+
+    const unsigned num_probes = 3;
+    std::vector<double> probe_guess(mSizeOfOdeSystem);
+    for (unsigned probe=1; probe<=num_probes; probe++)
+    {
+        for (unsigned i=0; i<mSizeOfOdeSystem; i++)
+        {
+            double scale = (double)((i + probe)%num_probes + 1)/num_probes;
+            if (probe%2 == 0)
+            {
+                scale = -scale;
+            }
+            probe_guess[i] = rCurrentGuess[i] + 1e-3*scale*(1.0 + fabs(rCurrentGuess[i]));
+        }
+
+        ComputeNumericalJacobian(pAbstractOdeSystem, timeStep, time, rCurrentYValues, probe_guess);
+        for (unsigned i=0; i<mSizeOfOdeSystem; i++)
+        {
+            for (unsigned j=0; j<mSizeOfOdeSystem; j++)
+            {
+                if (mJacobian[i][j] != 0.0)
+                {
+                    non_zero[i][j] = true;
+                }
+            }
+        }
+    }
+
+    for (unsigned i=0; i<mSizeOfOdeSystem; i++)
+    {
+        mResidual[i] = residual[i];
+        for (unsigned j=0; j<mSizeOfOdeSystem; j++)
+        {
+            mJacobian[i][j] = jacobian[i*mSizeOfOdeSystem + j];
+        }
+    }
+
+    mJacobianColumnRows.assign(mSizeOfOdeSystem, std::vector<unsigned>());
+    for (unsigned j=0; j<mSizeOfOdeSystem; j++)
+    {
+        for (unsigned i=0; i<mSizeOfOdeSystem; i++)
+        {
+            if (non_zero[i][j])
+            {
+                mJacobianColumnRows[j].push_back(i);
+            }
+        }
+    }
+    mpJacobianPatternSystemType = &typeid(*pAbstractOdeSystem);
+
+    // Greedy colouring: put each column in the first colour whose columns share no rows with it
+    mColumnsOfColour.clear();
+    std::vector<std::vector<bool> > rows_used_by_colour;
+    for (unsigned j=0; j<mSizeOfOdeSystem; j++)
+    {
+        const std::vector<unsigned>& r_rows = mJacobianColumnRows[j];
+        unsigned colour = 0;
+        for ( ; colour<mColumnsOfColour.size(); colour++)
+        {
+            bool clash = false;
+            for (unsigned r=0; r<r_rows.size() && !clash; r++)
+            {
+                clash = rows_used_by_colour[colour][r_rows[r]];
+            }
+            if (!clash)
+            {
+                break;
+            }
+        }
+        if (colour == mColumnsOfColour.size())
+        {
+            mColumnsOfColour.push_back(std::vector<unsigned>());
+            rows_used_by_colour.push_back(std::vector<bool>(mSizeOfOdeSystem, false));
+        }
+        mColumnsOfColour[colour].push_back(j);
+        for (unsigned r=0; r<r_rows.size(); r++)
+        {
+            rows_used_by_colour[colour][r_rows[r]] = true;
+        }
+    }
 }
 
 void BackwardEulerIvpOdeSolver::CalculateNextYValue(AbstractOdeSystem* pAbstractOdeSystem,
@@ -178,11 +377,25 @@ void BackwardEulerIvpOdeSolver::CalculateNextYValue(AbstractOdeSystem* pAbstract
     const double eps = 1e-6; // JonW tolerance
     double norm = 2*eps;
 
+    if (!mJacobianColumnRows.empty() && typeid(*pAbstractOdeSystem) != *mpJacobianPatternSystemType)
+    {
+        // The sparsity pattern belongs to a different kind of ODE system, so detect it again
+        mJacobianColumnRows.clear();
+        mColumnsOfColour.clear();
+    }
+
+    // If Newton's method doesn't converge quickly with a coloured Jacobian, the sparsity pattern
+    // must be missing entries: the step is then restarted with full Jacobians, and the pattern is
+    // detected again (and added to) on the next step.
+    bool colouring_suspended = false;
+
     std::vector<double> current_guess(mSizeOfOdeSystem);
     current_guess.assign(rCurrentYValues.begin(), rCurrentYValues.end());
 
     while (norm > eps)
     {
+        bool coloured = mUseColouredNumericalJacobian && !mColumnsOfColour.empty();
+
         // Calculate Jacobian and mResidual for current guess
         ComputeResidual(pAbstractOdeSystem, timeStep, time, rCurrentYValues, current_guess);
         ComputeJacobian(pAbstractOdeSystem, timeStep, time, rCurrentYValues, current_guess);
@@ -202,8 +415,21 @@ void BackwardEulerIvpOdeSolver::CalculateNextYValue(AbstractOdeSystem* pAbstract
         }
 
         counter++;
+        if (coloured && (counter >= mMaxColouredNewtonIterations || !std::isfinite(norm)))
+        {
+            mColumnsOfColour.clear();
+            mUseColouredNumericalJacobian = false;
+            colouring_suspended = true;
+            current_guess.assign(rCurrentYValues.begin(), rCurrentYValues.end());
+            counter = 0;
+            norm = 2*eps;
+        }
         assert(counter < 20); // avoid infinite loops
     }
+    if (colouring_suspended)
+    {
+        mUseColouredNumericalJacobian = true;
+    }
     rNextYValues.assign(current_guess.begin(), current_guess.end());
 }
 
@@ -214,6 +440,9 @@ BackwardEulerIvpOdeSolver::BackwardEulerIvpOdeSolver(unsigned sizeOfOdeSystem)
     // default epsilon
     mNumericalJacobianEpsilon = 1e-6;
     mForceUseOfNumericalJacobian = false;
+    mUseColouredNumericalJacobian = false;
+    mMaxColouredNewtonIterations = 10;
+    mpJacobianPatternSystemType = nullptr;
 
     // allocate memory
     mResidual = new double[mSizeOfOdeSystem];
@@ -250,6 +479,32 @@ void BackwardEulerIvpOdeSolver::ForceUseOfNumericalJacobian()
     mForceUseOfNumericalJacobian = true;
 }
 
+void BackwardEulerIvpOdeSolver::SetUseColouredNumericalJacobian(bool useColouring)
+{
+    mUseColouredNumericalJacobian = useColouring;
+    mJacobianColumnRows.clear();
+    mColumnsOfColour.clear();
+}
+
+unsigned BackwardEulerIvpOdeSolver::GetNumberOfJacobianColours() const
+{
+    return mColumnsOfColour.size();
+}
+
+void BackwardEulerIvpOdeSolver::SetMaxColouredNewtonIterations(unsigned maxIterations)
+{
+    if (maxIterations == 0 || maxIterations >= 20)
+    {
+        EXCEPTION("The maximum number of coloured Newton iterations must be between 1 and 19.");
+    }
+    mMaxColouredNewtonIterations = maxIterations;
+}
+
+unsigned BackwardEulerIvpOdeSolver::GetMaxColouredNewtonIterations() const
+{
+    return mMaxColouredNewtonIterations;
+}
+
 
 // Serialization for Boost >= 1.36
 #include "SerializationExportWrapperForCpp.hpp"
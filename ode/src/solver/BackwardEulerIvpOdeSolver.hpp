@@ -39,7 +39,11 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "AbstractOneStepIvpOdeSolver.hpp"
 #include "AbstractOdeSystemWithAnalyticJacobian.hpp"
 
+#include <vector>
+#include <typeinfo>
+
 #include "ChasteSerialization.hpp"
+#include "ChasteSerializationVersion.hpp"
 #include <boost/serialization/base_object.hpp>
 
 #include "AbstractOneStepIvpOdeSolver.hpp"
@@ -67,6 +71,15 @@ private:
         //archive & mSizeOfOdeSystem; - this done in save and load construct now.
         archive & mNumericalJacobianEpsilon;
         archive & mForceUseOfNumericalJacobian;
+        if (version > 0)
+        {
+            archive & mUseColouredNumericalJacobian;
+        }
+        if (version > 1)
+        {
+            archive & mMaxColouredNewtonIterations;
+        }
+        // The sparsity pattern and colouring are not archived; they are detected again on the next solve.
     }
 
     /** The number of state variables in the ODE system. */
@@ -81,6 +94,33 @@ private:
      */
     bool mForceUseOfNumericalJacobian;
 
+    /**
+     * Whether to compute the numerical Jacobian using a column colouring of its
+     * sparsity pattern, perturbing all the columns of one colour at once.
+     */
+    bool mUseColouredNumericalJacobian;
+
+    /**
+     * The number of Newton iterations a step may take with a coloured numerical Jacobian
+     * before the sparsity pattern is assumed to be missing entries.  Defaults to 10.
+     */
+    unsigned mMaxColouredNewtonIterations;
+
+    /**
+     * For each column of the Jacobian, the rows with a (structurally) non-zero entry.
+     * Empty until the pattern has been detected.
+     */
+    std::vector<std::vector<unsigned> > mJacobianColumnRows;
+
+    /**
+     * The columns of the Jacobian grouped by colour: no two columns of the same
+     * colour have a non-zero entry in the same row.
+     */
+    std::vector<std::vector<unsigned> > mColumnsOfColour;
+
+    /** The type of ODE system #mJacobianColumnRows was detected for. */
+    const std::type_info* mpJacobianPatternSystemType;
+
     /*
      * NOTE: we use (unsafe) double pointers here rather than
      * std::vectors because using std::vectors would lead to a
@@ -158,6 +198,42 @@ private:
                                   std::vector<double>& rCurrentYValues,
                                   std::vector<double>& rCurrentGuess);
 
+    /**
+     * Compute the Jacobian of the ODE system numerically, using the column colouring
+     * in #mColumnsOfColour so that only one residual evaluation is needed per colour.
+     * Entries outside the sparsity pattern are left as zero.
+     *
+     * @param pAbstractOdeSystem  the ODE system to solve
+     * @param timeStep  dt
+     * @param time  the current time
+     * @param rCurrentYValues  the current (initial) state
+     * @param rCurrentGuess  current guess for the state at the next timestep
+     */
+    void ComputeColouredNumericalJacobian(AbstractOdeSystem* pAbstractOdeSystem,
+                                          double timeStep,
+                                          double time,
+                                          std::vector<double>& rCurrentYValues,
+                                          std::vector<double>& rCurrentGuess);
+
+    /**
+     * Record the sparsity pattern of the Jacobian and greedily colour its columns.
+     * The pattern is the union of the diagonal, any pattern detected before, and the
+     * entries which are non-zero in the Jacobian currently held in #mJacobian or in
+     * full numerical Jacobians at a few states near the current guess.  #mJacobian
+     * and #mResidual are left as they were.
+     *
+     * @param pAbstractOdeSystem  the ODE system to solve
+     * @param timeStep  dt
+     * @param time  the current time
+     * @param rCurrentYValues  the current (initial) state
+     * @param rCurrentGuess  current guess for the state at the next timestep
+     */
+    void DetectJacobianSparsity(AbstractOdeSystem* pAbstractOdeSystem,
+                                double timeStep,
+                                double time,
+                                std::vector<double>& rCurrentYValues,
+                                std::vector<double>& rCurrentGuess);
+
 protected:
 
     /**
@@ -207,6 +283,49 @@ public:
      */
     void ForceUseOfNumericalJacobian();
 
+    /**
+     * Set whether the numerical Jacobian should exploit sparsity.  If so, the sparsity
+     * pattern is detected from the first full numerical Jacobian computed, its columns
+     * are coloured, and thereafter each Jacobian costs one right-hand side evaluation
+     * per colour rather than one per state variable (e.g. 3 for a tridiagonal system
+     * of any size).
+     *
+     * The pattern is taken from the entries which are non-zero at that first guess or
+     * at a few states near it, so entries which merely happen to vanish there are kept.
+     * If Newton's method then has not converged after GetMaxColouredNewtonIterations()
+     * iterations, or produces an update which is not finite, the pattern is assumed to be
+     * missing entries: that step is redone with full Jacobians and the pattern is extended
+     * on the next step.  The pattern is also detected afresh when an
+     * ODE system of a different type is solved.  Calling this method again forces the
+     * pattern to be re-detected.
+     *
+     * @param useColouring  whether to use a coloured numerical Jacobian (defaults to true)
+     */
+    void SetUseColouredNumericalJacobian(bool useColouring=true);
+
+    /**
+     * @return the number of colours (and hence right-hand side evaluations) used for each
+     * coloured numerical Jacobian, or zero if the sparsity pattern has not been detected.
+     */
+    unsigned GetNumberOfJacobianColours() const;
+
+    /**
+     * Set the number of Newton iterations a step may take with a coloured numerical
+     * Jacobian before it is redone with full Jacobians (see SetUseColouredNumericalJacobian()).
+     * With the right pattern Newton's method converges as quickly as with a full Jacobian,
+     * so this only needs to exceed the iterations a step normally takes.  Since a step may
+     * take at most 20 iterations, the value must be between 1 and 19.
+     *
+     * @param maxIterations  the maximum number of coloured Newton iterations per step
+     */
+    void SetMaxColouredNewtonIterations(unsigned maxIterations);
+
+    /**
+     * @return the number of Newton iterations a step may take with a coloured numerical
+     * Jacobian before it is redone with full Jacobians.
+     */
+    unsigned GetMaxColouredNewtonIterations() const;
+
     /**
      * Public method used in archiving.
      *
@@ -215,6 +334,8 @@ public:
      unsigned GetSystemSize() const {return mSizeOfOdeSystem;};
 };
 
+BOOST_CLASS_VERSION(BackwardEulerIvpOdeSolver, 2u)
+
 #include "SerializationExportWrapper.hpp"
 CHASTE_CLASS_EXPORT(BackwardEulerIvpOdeSolver)
 
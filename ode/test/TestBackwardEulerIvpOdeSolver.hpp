@@ -48,6 +48,9 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "Ode5.hpp"
 #include "Ode5Jacobian.hpp"
 #include "VanDerPolOde.hpp"
+#include "TridiagonalOdeSystem.hpp"
+#include "ProductDecayOdeSystem.hpp"
+#include "SwitchedRotationOdeSystem.hpp"
 #include "BackwardEulerIvpOdeSolver.hpp"
 #include "OutputFileHandler.hpp"
 #include "ArchiveLocationInfo.hpp"
@@ -91,6 +94,21 @@ public:
         TS_ASSERT_DELTA(numerical_solution[0], analytical_solution[0], global_error_euler);
         TS_ASSERT_DELTA(numerical_solution[1], analytical_solution[1], global_error_euler);
         TS_ASSERT_DELTA(numerical_solution[2], analytical_solution[2], global_error_euler);
+
+        // The system is linear, so each step should solve (I - hA)y_{n+1} = y_n to within round-off
+        std::vector<double> y = ode_system.GetInitialConditions();
+        for (unsigned step=0; step<last; step++)
+        {
+            double y1 = ((1 + h_value)*y[1] - h_value*y[2])/(1 + h_value*h_value);
+            double y2 = ((1 - h_value)*y[2] + 2*h_value*y[1])/(1 + h_value*h_value);
+            y[0] = (y[0] - h_value*y1 + h_value*y2)/(1 - h_value);
+            y[1] = y1;
+            y[2] = y2;
+        }
+        for (unsigned i=0; i<3; i++)
+        {
+            TS_ASSERT_DELTA(numerical_solution[i], y[i], 1e-8);
+        }
     }
 
     void TestBackwardEulerNonlinearEquation()
@@ -225,6 +243,95 @@ public:
         TS_ASSERT_DELTA(solutions.rGetSolutions()[last][1], 0, 2);
     }
 
+    void TestBackwardEulerColouredNumericalJacobian()
+    {
+        double h_value = 0.01;
+        double end_time = 1.0;
+
+        TridiagonalOdeSystem ode_system;
+        BackwardEulerIvpOdeSolver backward_euler_solver(ode_system.GetNumberOfStateVariables());
+        std::vector<double> state_variables = ode_system.GetInitialConditions();
+        OdeSolution solutions = backward_euler_solver.Solve(&ode_system, state_variables, 0.0, end_time, h_value, h_value);
+        TS_ASSERT_EQUALS(backward_euler_solver.GetNumberOfJacobianColours(), 0u);
+
+        TridiagonalOdeSystem coloured_ode_system;
+        BackwardEulerIvpOdeSolver coloured_solver(coloured_ode_system.GetNumberOfStateVariables());
+        coloured_solver.SetUseColouredNumericalJacobian();
+        std::vector<double> coloured_state_variables = coloured_ode_system.GetInitialConditions();
+        OdeSolution coloured_solutions = coloured_solver.Solve(&coloured_ode_system, coloured_state_variables, 0.0, end_time, h_value, h_value);
+
+        // A tridiagonal Jacobian needs three colours, however big the system
+        TS_ASSERT_EQUALS(coloured_solver.GetNumberOfJacobianColours(), 3u);
+
+        unsigned last = solutions.GetNumberOfTimeSteps();
+        TS_ASSERT_EQUALS(coloured_solutions.GetNumberOfTimeSteps(), last);
+        for (unsigned i=0; i<ode_system.GetNumberOfStateVariables(); i++)
+        {
+            TS_ASSERT_DELTA(coloured_solutions.rGetSolutions()[last][i], solutions.rGetSolutions()[last][i], 1e-6);
+        }
+
+        // 1 + 3 rather than 1 + 10 right-hand side evaluations per Jacobian
+        TS_ASSERT_LESS_THAN(2*coloured_ode_system.mNumberOfEvaluations, ode_system.mNumberOfEvaluations);
+
+        // Switching off again clears the pattern
+        coloured_solver.SetUseColouredNumericalJacobian(false);
+        TS_ASSERT_EQUALS(coloured_solver.GetNumberOfJacobianColours(), 0u);
+    }
+
+    void TestColouredNumericalJacobianPatternIsRobust()
+    {
+        double h_value = 0.01;
+
+        // d(dy0/dt)/dy1 = -y0 is zero at the initial guess, but not at nearby states, so it is kept
+        ProductDecayOdeSystem product_ode;
+        BackwardEulerIvpOdeSolver coloured_solver(product_ode.GetNumberOfStateVariables());
+        coloured_solver.SetUseColouredNumericalJacobian();
+        std::vector<double> product_state = product_ode.GetInitialConditions();
+        coloured_solver.Solve(&product_ode, product_state, 0.0, 0.1, h_value);
+        TS_ASSERT_EQUALS(coloured_solver.GetNumberOfJacobianColours(), 2u);
+
+        // Solving a different kind of system (all of whose columns share row 0) detects its pattern afresh
+        OdeThirdOrder third_order_ode;
+        std::vector<double> third_order_state = third_order_ode.GetInitialConditions();
+        coloured_solver.Solve(&third_order_ode, third_order_state, 0.0, h_value, h_value);
+        TS_ASSERT_EQUALS(coloured_solver.GetNumberOfJacobianColours(), 3u);
+
+        OdeThirdOrder full_third_order_ode;
+        BackwardEulerIvpOdeSolver full_solver(full_third_order_ode.GetNumberOfStateVariables());
+        std::vector<double> full_third_order_state = full_third_order_ode.GetInitialConditions();
+        full_solver.Solve(&full_third_order_ode, full_third_order_state, 0.0, h_value, h_value);
+        for (unsigned i=0; i<3; i++)
+        {
+            TS_ASSERT_DELTA(third_order_state[i], full_third_order_state[i], 1e-6);
+        }
+
+        // The coupling only appears after the pattern has been detected, so Newton's method fails
+        // with the coloured Jacobian; the step is redone with full Jacobians and the pattern extended
+        SwitchedRotationOdeSystem rotation_ode;
+        BackwardEulerIvpOdeSolver rotation_solver(rotation_ode.GetNumberOfStateVariables());
+        rotation_solver.SetUseColouredNumericalJacobian();
+        TS_ASSERT_EQUALS(rotation_solver.GetMaxColouredNewtonIterations(), 10u);
+        TS_ASSERT_THROWS_THIS(rotation_solver.SetMaxColouredNewtonIterations(0),
+                              "The maximum number of coloured Newton iterations must be between 1 and 19.");
+        TS_ASSERT_THROWS_THIS(rotation_solver.SetMaxColouredNewtonIterations(20),
+                              "The maximum number of coloured Newton iterations must be between 1 and 19.");
+        rotation_solver.SetMaxColouredNewtonIterations(5);
+        std::vector<double> rotation_state = rotation_ode.GetInitialConditions();
+        rotation_solver.Solve(&rotation_ode, rotation_state, 0.0, 0.4, h_value);
+        TS_ASSERT_EQUALS(rotation_solver.GetNumberOfJacobianColours(), 1u);
+        rotation_solver.Solve(&rotation_ode, rotation_state, 0.4, 0.6, h_value);
+        TS_ASSERT_EQUALS(rotation_solver.GetNumberOfJacobianColours(), 2u);
+
+        SwitchedRotationOdeSystem full_rotation_ode;
+        BackwardEulerIvpOdeSolver full_rotation_solver(full_rotation_ode.GetNumberOfStateVariables());
+        std::vector<double> full_rotation_state = full_rotation_ode.GetInitialConditions();
+        full_rotation_solver.Solve(&full_rotation_ode, full_rotation_state, 0.0, 0.6, h_value);
+        for (unsigned i=0; i<2; i++)
+        {
+            TS_ASSERT_DELTA(rotation_state[i], full_rotation_state[i], 1e-6);
+        }
+    }
+
     void TestArchivingSolver()
     {
         OutputFileHandler handler("archive", false);
@@ -242,7 +349,10 @@ public:
             boost::archive::text_oarchive output_arch(ofs);
 
             // Set up a solver
-            AbstractIvpOdeSolver* const p_backward_euler_solver = new BackwardEulerIvpOdeSolver(ode_system.GetNumberOfStateVariables());
+            BackwardEulerIvpOdeSolver* const p_solver = new BackwardEulerIvpOdeSolver(ode_system.GetNumberOfStateVariables());
+            p_solver->SetUseColouredNumericalJacobian();
+            p_solver->SetMaxColouredNewtonIterations(5);
+            AbstractIvpOdeSolver* const p_backward_euler_solver = p_solver;
 
             // Should always archive a pointer
             output_arch << p_backward_euler_solver;
@@ -259,6 +369,12 @@ public:
             // Create a pointer
             AbstractIvpOdeSolver* p_backward_euler;
             input_arch >> p_backward_euler;
+
+            BackwardEulerIvpOdeSolver* p_solver = dynamic_cast<BackwardEulerIvpOdeSolver*>(p_backward_euler);
+            TS_ASSERT(p_solver != nullptr);
+            TS_ASSERT_EQUALS(p_solver->GetMaxColouredNewtonIterations(), 5u);
+            TS_ASSERT_EQUALS(p_solver->GetNumberOfJacobianColours(), 0u);
+
             OdeSolution solutions;
 
             std::vector<double> state_variables = ode_system.GetInitialConditions();
@@ -270,6 +386,9 @@ public:
             TS_ASSERT_DELTA(solutions.rGetSolutions()[last][0], 0, 2);
             TS_ASSERT_DELTA(solutions.rGetSolutions()[last][1], 0, 2);
 
+            // The colouring setting was restored, so the (dense) pattern has now been detected
+            TS_ASSERT_EQUALS(p_solver->GetNumberOfJacobianColours(), 2u);
+
             delete p_backward_euler;
         }
     }
@@ -0,0 +1,78 @@
+/*
+
+Copyright (c) 2005-2017, University of Oxford.
+All rights reserved.
+
+University of Oxford means the Chancellor, Masters and Scholars of the
+University of Oxford, having an administrative office at Wellington
+Square, Oxford OX1 2JD, UK.
+
+This file is part of Chaste.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+ * Redistributions of source code must retain the above copyright notice,
+   this list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+ * Neither the name of the University of Oxford nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#ifndef _SWITCHEDROTATIONODESYSTEM_HPP
+#define _SWITCHEDROTATIONODESYSTEM_HPP
+
+#include "AbstractOdeSystem.hpp"
+#include "OdeSystemInformation.hpp"
+
+/**
+ * A fast rotation which is switched on at time 0.5
+ *   dy0/dt = -c(t)*y1,  dy1/dt = c(t)*y0,  with c(t) = 0 for t < 0.5 and 1000 afterwards,
+ * so the Jacobian is zero until the switch and has non-zero off-diagonal entries after it.
+ */
+class SwitchedRotationOdeSystem : public AbstractOdeSystem
+{
+public:
+    SwitchedRotationOdeSystem()
+            : AbstractOdeSystem(2)
+    {
+        mpSystemInfo = OdeSystemInformation<SwitchedRotationOdeSystem>::Instance();
+    }
+
+    void EvaluateYDerivatives(double time, const std::vector<double>& rY, std::vector<double>& rDY)
+    {
+        double rate = (time < 0.5) ? 0.0 : 1000.0;
+        rDY[0] = -rate*rY[1];
+        rDY[1] = rate*rY[0];
+    }
+};
+
+template<>
+void OdeSystemInformation<SwitchedRotationOdeSystem>::Initialise()
+{
+    this->mVariableNames.push_back("y0");
+    this->mVariableUnits.push_back("dimensionless");
+    this->mInitialConditions.push_back(1.0);
+
+    this->mVariableNames.push_back("y1");
+    this->mVariableUnits.push_back("dimensionless");
+    this->mInitialConditions.push_back(0.0);
+
+    this->mInitialised = true;
+}
+
+#endif //_SWITCHEDROTATIONODESYSTEM_HPP
@@ -0,0 +1,88 @@
+/*
+
+Copyright (c) 2005-2017, University of Oxford.
+All rights reserved.
+
+University of Oxford means the Chancellor, Masters and Scholars of the
+University of Oxford, having an administrative office at Wellington
+Square, Oxford OX1 2JD, UK.
+
+This file is part of Chaste.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+ * Redistributions of source code must retain the above copyright notice,
+   this list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+ * Neither the name of the University of Oxford nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#ifndef _TRIDIAGONALODESYSTEM_HPP
+#define _TRIDIAGONALODESYSTEM_HPP
+
+#include <cmath>
+#include <string>
+#include "AbstractOdeSystem.hpp"
+#include "OdeSystemInformation.hpp"
+
+/**
+ * A chain of ten nonlinearly decaying, diffusively coupled variables
+ *   dy_i/dt = y_{i-1} - 2y_i + y_{i+1} - y_i^3
+ * whose Jacobian is tridiagonal.  Counts its right-hand side evaluations.
+ */
+class TridiagonalOdeSystem : public AbstractOdeSystem
+{
+public:
+    /** The number of calls to EvaluateYDerivatives so far. */
+    unsigned mNumberOfEvaluations;
+
+    TridiagonalOdeSystem()
+            : AbstractOdeSystem(10),
+              mNumberOfEvaluations(0u)
+    {
+        mpSystemInfo = OdeSystemInformation<TridiagonalOdeSystem>::Instance();
+    }
+
+    void EvaluateYDerivatives(double time, const std::vector<double>& rY, std::vector<double>& rDY)
+    {
+        const unsigned size = rY.size();
+        for (unsigned i=0; i<size; i++)
+        {
+            double left = (i > 0) ? rY[i-1] : 0.0;
+            double right = (i+1 < size) ? rY[i+1] : 0.0;
+            rDY[i] = left - 2.0*rY[i] + right - rY[i]*rY[i]*rY[i];
+        }
+        mNumberOfEvaluations++;
+    }
+};
+
+template<>
+void OdeSystemInformation<TridiagonalOdeSystem>::Initialise()
+{
+    for (unsigned i=0; i<10; i++)
+    {
+        this->mVariableNames.push_back(std::string("y") + char('0' + i));
+        this->mVariableUnits.push_back("dimensionless");
+        this->mInitialConditions.push_back(sin(M_PI*(i+1)/11.0));
+    }
+
+    this->mInitialised = true;
+}
+
+#endif //_TRIDIAGONALODESYSTEM_HPP
@@ -215,6 +215,7 @@ void FineCoarseMeshPair<DIM>::ComputeFineElementsAndWeightsForCoarseQuadPoints(G
 
 
     ResetStatisticsVariables();
+    bool set_up_spatial_index = SetUpElementSpatialIndexForSafeMode(mrFineMesh, safeMode);
     for (unsigned i=0; i<quad_point_posns.Size(); i++)
     {
         // LCOV_EXCL_START
@@ -239,6 +240,10 @@ void FineCoarseMeshPair<DIM>::ComputeFineElementsAndWeightsForCoarseQuadPoints(G
             assert(norm_2(mFineMeshElementsAndWeights[i].Weights) == 0.0 );
         }
     }
+    if (set_up_spatial_index)
+    {
+        mrFineMesh.ClearElementSpatialIndex();
+    }
     ShareFineElementData();
     if (mStatisticsCounters[1] > 0)
     {
@@ -272,6 +277,7 @@ void FineCoarseMeshPair<DIM>::ComputeFineElementsAndWeightsForCoarseNodes(bool s
 
 
     ResetStatisticsVariables();
+    bool set_up_spatial_index = SetUpElementSpatialIndexForSafeMode(mrFineMesh, safeMode);
     for (unsigned i=0; i<mrCoarseMesh.GetNumNodes(); i++)
     {
         // LCOV_EXCL_START
@@ -293,6 +299,10 @@ void FineCoarseMeshPair<DIM>::ComputeFineElementsAndWeightsForCoarseNodes(bool s
             ComputeFineElementAndWeightForGivenPoint(point, safeMode, box_for_this_point, i);
         }
     }
+    if (set_up_spatial_index)
+    {
+        mrFineMesh.ClearElementSpatialIndex();
+    }
     ShareFineElementData();
 }
 
@@ -418,6 +428,7 @@ void FineCoarseMeshPair<DIM>::ComputeCoarseElementsForFineNodes(bool safeMode)
     mCoarseElementsForFineNodes.resize(mrFineMesh.GetNumNodes(), 0.0);
 
     ResetStatisticsVariables();
+    bool set_up_spatial_index = SetUpElementSpatialIndexForSafeMode(mrCoarseMesh, safeMode);
     for (unsigned i=0; i<mCoarseElementsForFineNodes.size(); i++)
     {
         // LCOV_EXCL_START
@@ -436,6 +447,10 @@ void FineCoarseMeshPair<DIM>::ComputeCoarseElementsForFineNodes(bool safeMode)
             mCoarseElementsForFineNodes[i] = ComputeCoarseElementForGivenPoint(point, safeMode, box_for_this_point);
         }
     }
+    if (set_up_spatial_index)
+    {
+        mrCoarseMesh.ClearElementSpatialIndex();
+    }
     ShareCoarseElementData();
 }
 
@@ -458,6 +473,7 @@ void FineCoarseMeshPair<DIM>::ComputeCoarseElementsForFineElementCentroids(bool
     mCoarseElementsForFineElementCentroids.resize(mrFineMesh.GetNumElements(), 0.0);
 
     ResetStatisticsVariables();
+    bool set_up_spatial_index = SetUpElementSpatialIndexForSafeMode(mrCoarseMesh, safeMode);
     for (unsigned i=0; i<mrFineMesh.GetNumElements(); i++)
     {
         // LCOV_EXCL_START
@@ -478,6 +494,10 @@ void FineCoarseMeshPair<DIM>::ComputeCoarseElementsForFineElementCentroids(bool
             mCoarseElementsForFineElementCentroids[i] = ComputeCoarseElementForGivenPoint(point, safeMode, box_for_this_point);
         }
     }
+    if (set_up_spatial_index)
+    {
+        mrCoarseMesh.ClearElementSpatialIndex();
+    }
     ShareCoarseElementData();
 }
 
@@ -589,6 +609,17 @@ void FineCoarseMeshPair<DIM>::CollectElementsInLocalBoxes(DistributedBoxCollecti
     }
 }
 
+template<unsigned DIM>
+bool FineCoarseMeshPair<DIM>::SetUpElementSpatialIndexForSafeMode(AbstractTetrahedralMesh<DIM,DIM>& rMesh, bool safeMode)
+{
+    if (!safeMode || rMesh.IsElementSpatialIndexSetUp())
+    {
+        return false;
+    }
+    rMesh.SetUpElementSpatialIndex();
+    return true;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////
 // Statistics related methods
 ////////////////////////////////////////////////////////////////////////////////////
@@ -247,6 +247,18 @@ private:
      */
     void ShareCoarseElementData();
 
+    /**
+     * In safe mode, a point that is not in any element of the nearby boxes is searched for in
+     * the whole mesh. Set up the element spatial index on the mesh being searched, if it is not
+     * set up already, so that these searches only test the elements near the point.
+     *
+     * @param rMesh the mesh to be searched
+     * @param safeMode whether the search is being done in safe mode
+     * @return whether this call set up the index, in which case the caller should clear it again
+     *     once the search is over
+     */
+    bool SetUpElementSpatialIndexForSafeMode(AbstractTetrahedralMesh<DIM,DIM>& rMesh, bool safeMode);
+
 public:
 
     /**
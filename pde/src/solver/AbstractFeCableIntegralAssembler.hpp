@@ -358,6 +358,12 @@ void AbstractFeCableIntegralAssembler<ELEMENT_DIM, SPACE_DIM, PROBLEM_DIM, CAN_A
     c_vector<double, NUM_CABLE_ELEMENT_NODES> phi;
     c_matrix<double, SPACE_DIM, NUM_CABLE_ELEMENT_NODES> grad_phi;
 
+    // The derivatives of linear basis functions are constant on an element, so only transform them once
+    if (this->mAssembleMatrix || INTERPOLATION_LEVEL==NONLINEAR)
+    {
+        ComputeTransformedBasisFunctionDerivatives(mpCableQuadRule->rGetQuadPoint(0), inverse_jacobian, grad_phi);
+    }
+
     // Loop over Gauss points
     for (unsigned quad_index=0; quad_index < mpCableQuadRule->GetNumQuadPoints(); quad_index++)
     {
@@ -365,11 +371,6 @@ void AbstractFeCableIntegralAssembler<ELEMENT_DIM, SPACE_DIM, PROBLEM_DIM, CAN_A
 
         CableBasisFunction::ComputeBasisFunctions(quad_point, phi);
 
-        if (this->mAssembleMatrix || INTERPOLATION_LEVEL==NONLINEAR)
-        {
-            ComputeTransformedBasisFunctionDerivatives(quad_point, inverse_jacobian, grad_phi);
-        }
-
         // Location of the Gauss point in the original element will be stored in x
         // Where applicable, u will be set to the value of the current solution at x
         ChastePoint<SPACE_DIM> x(0,0,0);
@@ -42,6 +42,9 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "PetscVecTools.hpp"
 #include "PetscMatTools.hpp"
 
+#include <algorithm>
+#include <vector>
+
 /**
  *
  * An abstract class for creating finite element vectors or matrices that are defined
@@ -88,6 +91,41 @@ protected:
     /** Basis function for use with normal elements. */
     typedef LinearBasisFunction<ELEMENT_DIM> BasisFunction;
 
+    /**
+     * Whether to add element matrices directly into the stored values of the matrix being
+     * assembled, when it is a sequential AIJ matrix whose sparsity pattern is already known
+     * (i.e. on reassembly). See SetAddElementMatricesInPlace().
+     */
+    bool mAddElementMatricesInPlace;
+
+    /**
+     * For each element (by element index), the position in the matrix values array of each
+     * entry of its element matrix, in row-major order, or -1 if not yet looked up. Only used
+     * when mAddElementMatricesInPlace is true. Each offset is checked against the matrix's
+     * sparsity pattern before use, and looked up again if the pattern has changed.
+     */
+    std::vector<PetscInt> mElementMatrixValueOffsets;
+
+    /**
+     * Add an element matrix directly into the stored values of a sequential AIJ matrix,
+     * using (and if necessary updating) the cached offsets for this element.
+     *
+     * @param elementIndex the index of the element
+     * @param pIndices the global matrix indices of the element matrix rows and columns
+     * @param rAElem the element matrix
+     * @param pRowStarts the row offsets of the matrix (see PetscMatTools::GetSeqAijArrays())
+     * @param pColumnIndices the column indices of the matrix
+     * @param pValues the values of the matrix
+     * @return whether the element matrix was added, which is false if any of its entries
+     *     is not in the sparsity pattern of the matrix (in which case nothing was added)
+     */
+    bool AddElementMatrixInPlace(unsigned elementIndex,
+                                 const unsigned* pIndices,
+                                 const c_matrix<double, PROBLEM_DIM*(ELEMENT_DIM+1), PROBLEM_DIM*(ELEMENT_DIM+1)>& rAElem,
+                                 const PetscInt* pRowStarts,
+                                 const PetscInt* pColumnIndices,
+                                 PetscScalar* pValues);
+
     /**
      * Compute the derivatives of all basis functions at a point within an element.
      * This method will transform the results, for use within Gaussian quadrature
@@ -238,13 +276,35 @@ public:
     {
         delete mpQuadRule;
     }
+
+    /**
+     * Set whether to add element matrices directly into the stored values of the matrix
+     * being assembled, rather than through MatSetValues(). This only takes effect when the
+     * matrix is a sequential AIJ matrix (i.e. on a single process) that has already been
+     * assembled once, so it benefits problems that reassemble the same matrix repeatedly,
+     * such as Jacobians in a nonlinear solve. The position of each element matrix entry in
+     * the matrix storage is looked up once and cached, which costs
+     * (PROBLEM_DIM*(ELEMENT_DIM+1))^2 integers per element. The assembled matrix is
+     * identical either way. Defaults to false.
+     *
+     * @param addInPlace whether to add element matrices in place
+     */
+    void SetAddElementMatricesInPlace(bool addInPlace)
+    {
+        mAddElementMatricesInPlace = addInPlace;
+        if (!addInPlace)
+        {
+            mElementMatrixValueOffsets.clear();
+        }
+    }
 };
 
 template <unsigned ELEMENT_DIM, unsigned SPACE_DIM, unsigned PROBLEM_DIM, bool CAN_ASSEMBLE_VECTOR, bool CAN_ASSEMBLE_MATRIX, InterpolationLevel INTERPOLATION_LEVEL>
 AbstractFeVolumeIntegralAssembler<ELEMENT_DIM, SPACE_DIM, PROBLEM_DIM, CAN_ASSEMBLE_VECTOR, CAN_ASSEMBLE_MATRIX, INTERPOLATION_LEVEL>::AbstractFeVolumeIntegralAssembler(
             AbstractTetrahedralMesh<ELEMENT_DIM,SPACE_DIM>* pMesh)
     : AbstractFeAssemblerCommon<ELEMENT_DIM, SPACE_DIM, PROBLEM_DIM, CAN_ASSEMBLE_VECTOR, CAN_ASSEMBLE_MATRIX, INTERPOLATION_LEVEL>(),
-      mpMesh(pMesh)
+      mpMesh(pMesh),
+      mAddElementMatricesInPlace(false)
 {
     assert(pMesh);
     // Default to 2nd order quadrature.  Our default basis functions are piecewise linear
@@ -293,6 +353,18 @@ void AbstractFeVolumeIntegralAssembler<ELEMENT_DIM, SPACE_DIM, PROBLEM_DIM, CAN_
     c_matrix<double, STENCIL_SIZE, STENCIL_SIZE> a_elem;
     c_vector<double, STENCIL_SIZE> b_elem;
 
+    // If requested and possible, get direct access to the stored values of the matrix
+    PetscInt num_rows = 0;
+    const PetscInt* p_row_starts = nullptr;
+    const PetscInt* p_column_indices = nullptr;
+    PetscScalar* p_values = nullptr;
+    bool add_matrix_in_place = this->mAssembleMatrix && mAddElementMatricesInPlace
+                               && PetscMatTools::GetSeqAijArrays(this->mMatrixToAssemble, num_rows, p_row_starts, p_column_indices, p_values);
+
+    // Element matrices with entries outside the sparsity pattern, to be added once direct access is released
+    std::vector<unsigned> deferred_indices;
+    std::vector<c_matrix<double, STENCIL_SIZE, STENCIL_SIZE> > deferred_matrices;
+
     // Loop over elements
     for (typename AbstractTetrahedralMesh<ELEMENT_DIM, SPACE_DIM>::ElementIterator iter = mpMesh->GetElementIteratorBegin();
          iter != mpMesh->GetElementIteratorEnd();
@@ -310,7 +382,15 @@ void AbstractFeVolumeIntegralAssembler<ELEMENT_DIM, SPACE_DIM, PROBLEM_DIM, CAN_
 
             if (this->mAssembleMatrix)
             {
-                PetscMatTools::AddMultipleValues<STENCIL_SIZE>(this->mMatrixToAssemble, p_indices, a_elem);
+                if (!add_matrix_in_place)
+                {
+                    PetscMatTools::AddMultipleValues<STENCIL_SIZE>(this->mMatrixToAssemble, p_indices, a_elem);
+                }
+                else if (!AddElementMatrixInPlace(r_element.GetIndex(), p_indices, a_elem, p_row_starts, p_column_indices, p_values))
+                {
+                    deferred_indices.insert(deferred_indices.end(), p_indices, p_indices + STENCIL_SIZE);
+                    deferred_matrices.push_back(a_elem);
+                }
             }
 
             if (this->mAssembleVector)
@@ -320,9 +400,73 @@ void AbstractFeVolumeIntegralAssembler<ELEMENT_DIM, SPACE_DIM, PROBLEM_DIM, CAN_
         }
     }
 
+    if (add_matrix_in_place)
+    {
+        PetscMatTools::RestoreSeqAijArrays(this->mMatrixToAssemble, num_rows, p_row_starts, p_column_indices, p_values);
+
+        for (unsigned i=0; i<deferred_matrices.size(); i++)
+        {
+            PetscMatTools::AddMultipleValues<STENCIL_SIZE>(this->mMatrixToAssemble, &deferred_indices[i*STENCIL_SIZE], deferred_matrices[i]);
+        }
+    }
+
     HeartEventHandler::EndEvent(assemble_event);
 }
 
+template <unsigned ELEMENT_DIM, unsigned SPACE_DIM, unsigned PROBLEM_DIM, bool CAN_ASSEMBLE_VECTOR, bool CAN_ASSEMBLE_MATRIX, InterpolationLevel INTERPOLATION_LEVEL>
+bool AbstractFeVolumeIntegralAssembler<ELEMENT_DIM, SPACE_DIM, PROBLEM_DIM, CAN_ASSEMBLE_VECTOR, CAN_ASSEMBLE_MATRIX, INTERPOLATION_LEVEL>::AddElementMatrixInPlace(
+    unsigned elementIndex,
+    const unsigned* pIndices,
+    const c_matrix<double, PROBLEM_DIM*(ELEMENT_DIM+1), PROBLEM_DIM*(ELEMENT_DIM+1)>& rAElem,
+    const PetscInt* pRowStarts,
+    const PetscInt* pColumnIndices,
+    PetscScalar* pValues)
+{
+    const unsigned STENCIL_SIZE = PROBLEM_DIM*(ELEMENT_DIM+1);
+    const unsigned NUM_ENTRIES = STENCIL_SIZE*STENCIL_SIZE;
+
+    if (mElementMatrixValueOffsets.size() < (elementIndex+1)*NUM_ENTRIES)
+    {
+        mElementMatrixValueOffsets.resize((elementIndex+1)*NUM_ENTRIES, -1);
+    }
+    PetscInt* p_offsets = &mElementMatrixValueOffsets[elementIndex*NUM_ENTRIES];
+
+    // Check each cached offset refers to the right entry, and look it up again if not
+    for (unsigned row=0; row<STENCIL_SIZE; row++)
+    {
+        PetscInt global_row = pIndices[row];
+        PetscInt row_start = pRowStarts[global_row];
+        PetscInt row_end = pRowStarts[global_row+1];
+
+        for (unsigned col=0; col<STENCIL_SIZE; col++)
+        {
+            PetscInt global_col = pIndices[col];
+            PetscInt& r_offset = p_offsets[row*STENCIL_SIZE + col];
+
+            if (r_offset < row_start || r_offset >= row_end || pColumnIndices[r_offset] != global_col)
+            {
+                const PetscInt* p_entry = std::lower_bound(pColumnIndices + row_start, pColumnIndices + row_end, global_col);
+                if (p_entry == pColumnIndices + row_end || *p_entry != global_col)
+                {
+                    // This entry is not in the sparsity pattern
+                    return false;
+                }
+                r_offset = p_entry - pColumnIndices;
+            }
+        }
+    }
+
+    // All the entries are present, so add the element matrix
+    for (unsigned row=0; row<STENCIL_SIZE; row++)
+    {
+        for (unsigned col=0; col<STENCIL_SIZE; col++)
+        {
+            pValues[p_offsets[row*STENCIL_SIZE + col]] += rAElem(row, col);
+        }
+    }
+    return true;
+}
+
 
 ///////////////////////////////////////////////////////////////////////////////////
 // Implementation - AssembleOnElement and smaller
@@ -374,6 +518,16 @@ void AbstractFeVolumeIntegralAssembler<ELEMENT_DIM, SPACE_DIM, PROBLEM_DIM, CAN_
     c_vector<double, ELEMENT_DIM+1> phi;
     c_matrix<double, SPACE_DIM, ELEMENT_DIM+1> grad_phi;
 
+    /*
+     * The derivatives of linear basis functions are constant on an element (as is
+     * the Jacobian, see above), so transform them once here rather than at every
+     * Gauss point.
+     */
+    if (this->mAssembleMatrix || INTERPOLATION_LEVEL==NONLINEAR)
+    {
+        ComputeTransformedBasisFunctionDerivatives(mpQuadRule->rGetQuadPoint(0), inverse_jacobian, grad_phi);
+    }
+
     // Loop over Gauss points
     for (unsigned quad_index=0; quad_index < mpQuadRule->GetNumQuadPoints(); quad_index++)
     {
@@ -381,11 +535,6 @@ void AbstractFeVolumeIntegralAssembler<ELEMENT_DIM, SPACE_DIM, PROBLEM_DIM, CAN_
 
         BasisFunction::ComputeBasisFunctions(quad_point, phi);
 
-        if (this->mAssembleMatrix || INTERPOLATION_LEVEL==NONLINEAR)
-        {
-            ComputeTransformedBasisFunctionDerivatives(quad_point, inverse_jacobian, grad_phi);
-        }
-
         // Location of the Gauss point in the original element will be stored in x
         // Where applicable, u will be set to the value of the current solution at x
         ChastePoint<SPACE_DIM> x(0,0,0);
@@ -0,0 +1,92 @@
+/*
+
+Copyright (c) 2005-2017, University of Oxford.
+All rights reserved.
+
+University of Oxford means the Chancellor, Masters and Scholars of the
+University of Oxford, having an administrative office at Wellington
+Square, Oxford OX1 2JD, UK.
+
+This file is part of Chaste.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+ * Redistributions of source code must retain the above copyright notice,
+   this list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+ * Neither the name of the University of Oxford nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "TabulatedBasisFunctions.hpp"
+#include "LinearBasisFunction.hpp"
+#include "QuadraticBasisFunction.hpp"
+#include <cassert>
+
+template<unsigned ELEMENT_DIM>
+TabulatedBasisFunctions<ELEMENT_DIM>::TabulatedBasisFunctions(const GaussianQuadratureRule<ELEMENT_DIM>& rQuadRule)
+{
+    unsigned num_quad_points = rQuadRule.GetNumQuadPoints();
+    mLinearBasisFunctions.resize(num_quad_points);
+    mQuadraticBasisFunctions.resize(num_quad_points);
+    mQuadraticBasisFunctionDerivatives.resize(num_quad_points);
+
+    for (unsigned quad_index=0; quad_index<num_quad_points; quad_index++)
+    {
+        const ChastePoint<ELEMENT_DIM>& r_quad_point = rQuadRule.rGetQuadPoint(quad_index);
+
+        LinearBasisFunction<ELEMENT_DIM>::ComputeBasisFunctions(r_quad_point, mLinearBasisFunctions[quad_index]);
+        QuadraticBasisFunction<ELEMENT_DIM>::ComputeBasisFunctions(r_quad_point, mQuadraticBasisFunctions[quad_index]);
+        QuadraticBasisFunction<ELEMENT_DIM>::ComputeBasisFunctionDerivatives(r_quad_point, mQuadraticBasisFunctionDerivatives[quad_index]);
+    }
+}
+
+template<unsigned ELEMENT_DIM>
+unsigned TabulatedBasisFunctions<ELEMENT_DIM>::GetNumQuadPoints() const
+{
+    return mLinearBasisFunctions.size();
+}
+
+template<unsigned ELEMENT_DIM>
+const c_vector<double, ELEMENT_DIM+1>& TabulatedBasisFunctions<ELEMENT_DIM>::rGetLinearBasisFunctions(unsigned quadIndex) const
+{
+    assert(quadIndex < mLinearBasisFunctions.size());
+    return mLinearBasisFunctions[quadIndex];
+}
+
+template<unsigned ELEMENT_DIM>
+const c_vector<double, (ELEMENT_DIM+1)*(ELEMENT_DIM+2)/2>& TabulatedBasisFunctions<ELEMENT_DIM>::rGetQuadraticBasisFunctions(unsigned quadIndex) const
+{
+    assert(quadIndex < mQuadraticBasisFunctions.size());
+    return mQuadraticBasisFunctions[quadIndex];
+}
+
+template<unsigned ELEMENT_DIM>
+void TabulatedBasisFunctions<ELEMENT_DIM>::ComputeTransformedQuadraticBasisFunctionDerivatives(
+        unsigned quadIndex,
+        const c_matrix<double, ELEMENT_DIM, ELEMENT_DIM>& rInverseJacobian,
+        c_matrix<double, ELEMENT_DIM, (ELEMENT_DIM+1)*(ELEMENT_DIM+2)/2>& rReturnValue) const
+{
+    assert(quadIndex < mQuadraticBasisFunctionDerivatives.size());
+    rReturnValue = prod(trans(rInverseJacobian), mQuadraticBasisFunctionDerivatives[quadIndex]);
+}
+
+// Explicit instantiation
+template class TabulatedBasisFunctions<1>;
+template class TabulatedBasisFunctions<2>;
+template class TabulatedBasisFunctions<3>;
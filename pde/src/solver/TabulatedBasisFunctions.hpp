@@ -0,0 +1,114 @@
+/*
+
+Copyright (c) 2005-2017, University of Oxford.
+All rights reserved.
+
+University of Oxford means the Chancellor, Masters and Scholars of the
+University of Oxford, having an administrative office at Wellington
+Square, Oxford OX1 2JD, UK.
+
+This file is part of Chaste.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+ * Redistributions of source code must retain the above copyright notice,
+   this list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+ * Neither the name of the University of Oxford nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#ifndef TABULATEDBASISFUNCTIONS_HPP_
+#define TABULATEDBASISFUNCTIONS_HPP_
+
+#include <vector>
+#include "UblasMatrixInclude.hpp"
+#include "GaussianQuadratureRule.hpp"
+
+/**
+ * The values of the linear and quadratic basis functions, and the derivatives of the
+ * quadratic basis functions, at each point of a Gaussian quadrature rule on the canonical
+ * element.
+ *
+ * These only depend on the quadrature rule, so assemblers that loop over many elements
+ * can compute them once here rather than at every quadrature point of every element.
+ * Only the (element-dependent) transformation of the derivatives then remains to be
+ * done per element. The results are identical to calling the methods of
+ * LinearBasisFunction and QuadraticBasisFunction directly.
+ *
+ * (The derivatives of the linear basis functions are constant on the canonical element,
+ * so are not tabulated: use LinearBasisFunction::ComputeTransformedBasisFunctionDerivatives().)
+ */
+template<unsigned ELEMENT_DIM>
+class TabulatedBasisFunctions
+{
+private:
+
+    /** The values of the linear basis functions at each quadrature point. */
+    std::vector<c_vector<double, ELEMENT_DIM+1> > mLinearBasisFunctions;
+
+    /** The values of the quadratic basis functions at each quadrature point. */
+    std::vector<c_vector<double, (ELEMENT_DIM+1)*(ELEMENT_DIM+2)/2> > mQuadraticBasisFunctions;
+
+    /** The (untransformed) derivatives of the quadratic basis functions at each quadrature point. */
+    std::vector<c_matrix<double, ELEMENT_DIM, (ELEMENT_DIM+1)*(ELEMENT_DIM+2)/2> > mQuadraticBasisFunctionDerivatives;
+
+public:
+
+    /**
+     * Constructor. Evaluates the basis functions at each point of the given rule.
+     *
+     * @param rQuadRule the quadrature rule
+     */
+    TabulatedBasisFunctions(const GaussianQuadratureRule<ELEMENT_DIM>& rQuadRule);
+
+    /**
+     * @return the number of quadrature points.
+     */
+    unsigned GetNumQuadPoints() const;
+
+    /**
+     * @return the values of the linear basis functions at a quadrature point.
+     *
+     * @param quadIndex the index of the quadrature point
+     */
+    const c_vector<double, ELEMENT_DIM+1>& rGetLinearBasisFunctions(unsigned quadIndex) const;
+
+    /**
+     * @return the values of the quadratic basis functions at a quadrature point.
+     *
+     * @param quadIndex the index of the quadrature point
+     */
+    const c_vector<double, (ELEMENT_DIM+1)*(ELEMENT_DIM+2)/2>& rGetQuadraticBasisFunctions(unsigned quadIndex) const;
+
+    /**
+     * Compute the derivatives of the quadratic basis functions at a quadrature point,
+     * transformed to an element with the given inverse Jacobian. Equivalent to
+     * QuadraticBasisFunction::ComputeTransformedBasisFunctionDerivatives().
+     *
+     * @param quadIndex the index of the quadrature point
+     * @param rInverseJacobian the inverse of the Jacobian matrix mapping the real
+     *     element into the canonical element
+     * @param rReturnValue the transformed derivatives, to be filled in
+     */
+    void ComputeTransformedQuadraticBasisFunctionDerivatives(unsigned quadIndex,
+                                                             const c_matrix<double, ELEMENT_DIM, ELEMENT_DIM>& rInverseJacobian,
+                                                             c_matrix<double, ELEMENT_DIM, (ELEMENT_DIM+1)*(ELEMENT_DIM+2)/2>& rReturnValue) const;
+};
+
+#endif // TABULATEDBASISFUNCTIONS_HPP_
@@ -0,0 +1,119 @@
+/*
+
+Copyright (c) 2005-2017, University of Oxford.
+All rights reserved.
+
+University of Oxford means the Chancellor, Masters and Scholars of the
+University of Oxford, having an administrative office at Wellington
+Square, Oxford OX1 2JD, UK.
+
+This file is part of Chaste.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+ * Redistributions of source code must retain the above copyright notice,
+   this list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+ * Neither the name of the University of Oxford nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#ifndef _TESTBASISFUNCTIONEVALUATIONEFFICIENCY_HPP_
+#define _TESTBASISFUNCTIONEVALUATIONEFFICIENCY_HPP_
+
+#include <cxxtest/TestSuite.h>
+#include <iostream>
+#include "TabulatedBasisFunctions.hpp"
+#include "LinearBasisFunction.hpp"
+#include "QuadraticBasisFunction.hpp"
+#include "Timer.hpp"
+
+#include "PetscSetupAndFinalize.hpp"
+
+/**
+ * Reports the number of elements per second for which the basis functions (and
+ * transformed derivatives) can be evaluated at every quadrature point, both directly
+ * and using TabulatedBasisFunctions.
+ */
+class TestBasisFunctionEvaluationEfficiency : public CxxTest::TestSuite
+{
+private:
+
+    template<unsigned DIM>
+    void CompareEvaluationRates(unsigned numElements)
+    {
+        const unsigned NUM_QUADRATIC_BASIS_FUNCTIONS = (DIM+1)*(DIM+2)/2;
+
+        GaussianQuadratureRule<DIM> quad_rule(3);
+        TabulatedBasisFunctions<DIM> tabulated_basis_functions(quad_rule);
+
+        c_matrix<double, DIM, DIM> inverse_jacobian = identity_matrix<double>(DIM);
+        c_vector<double, DIM+1> linear_phi;
+        c_vector<double, NUM_QUADRATIC_BASIS_FUNCTIONS> quad_phi;
+        c_matrix<double, DIM, NUM_QUADRATIC_BASIS_FUNCTIONS> grad_quad_phi;
+
+        // Accumulate something from the results so the loops aren't optimised away
+        double direct_sum = 0.0;
+        Timer::Reset();
+        for (unsigned element=0; element<numElements; element++)
+        {
+            inverse_jacobian(0,0) = 1.0 + 1e-6*element;
+            for (unsigned quad_index=0; quad_index<quad_rule.GetNumQuadPoints(); quad_index++)
+            {
+                const ChastePoint<DIM>& r_quad_point = quad_rule.rGetQuadPoint(quad_index);
+                LinearBasisFunction<DIM>::ComputeBasisFunctions(r_quad_point, linear_phi);
+                QuadraticBasisFunction<DIM>::ComputeBasisFunctions(r_quad_point, quad_phi);
+                QuadraticBasisFunction<DIM>::ComputeTransformedBasisFunctionDerivatives(r_quad_point, inverse_jacobian, grad_quad_phi);
+                direct_sum += linear_phi(0) + quad_phi(0) + grad_quad_phi(0,0);
+            }
+        }
+        double direct_time = Timer::GetElapsedTime();
+
+        double tabulated_sum = 0.0;
+        Timer::Reset();
+        for (unsigned element=0; element<numElements; element++)
+        {
+            inverse_jacobian(0,0) = 1.0 + 1e-6*element;
+            for (unsigned quad_index=0; quad_index<quad_rule.GetNumQuadPoints(); quad_index++)
+            {
+                linear_phi = tabulated_basis_functions.rGetLinearBasisFunctions(quad_index);
+                quad_phi = tabulated_basis_functions.rGetQuadraticBasisFunctions(quad_index);
+                tabulated_basis_functions.ComputeTransformedQuadraticBasisFunctionDerivatives(quad_index, inverse_jacobian, grad_quad_phi);
+                tabulated_sum += linear_phi(0) + quad_phi(0) + grad_quad_phi(0,0);
+            }
+        }
+        double tabulated_time = Timer::GetElapsedTime();
+
+        TS_ASSERT_EQUALS(direct_sum, tabulated_sum);
+
+        std::cout << DIM << "d, " << quad_rule.GetNumQuadPoints() << " quadrature points: "
+                  << numElements/direct_time << " elements/s direct, "
+                  << numElements/tabulated_time << " elements/s tabulated\n";
+    }
+
+public:
+
+    void TestEvaluationRates()
+    {
+        CompareEvaluationRates<1>(1000000);
+        CompareEvaluationRates<2>(1000000);
+        CompareEvaluationRates<3>(1000000);
+    }
+};
+
+#endif // _TESTBASISFUNCTIONEVALUATIONEFFICIENCY_HPP_
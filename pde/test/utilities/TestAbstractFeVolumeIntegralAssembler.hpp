@@ -587,6 +587,56 @@ public:
         PetscTools::Destroy(mat);
     }
 
+    void TestAddElementMatricesInPlace()
+    {
+        TetrahedralMesh<2,2> mesh;
+        mesh.ConstructRegularSlabMesh(0.1, 0.5, 0.3);
+        unsigned num_nodes = mesh.GetNumNodes();
+
+        // Reference matrix, assembled in the usual way
+        Mat reference_mat;
+        PetscTools::SetupMat(reference_mat, num_nodes, num_nodes, 9);
+        StiffnessMatrixAssembler<2,2> reference_assembler(&mesh);
+        reference_assembler.SetMatrixToAssemble(reference_mat);
+        reference_assembler.Assemble();
+        PetscMatTools::Finalise(reference_mat);
+
+        // The first assembly cannot be done in place as the sparsity pattern is not yet known;
+        // subsequent ones can (on one process)
+        Mat mat;
+        PetscTools::SetupMat(mat, num_nodes, num_nodes, 9);
+        StiffnessMatrixAssembler<2,2> assembler(&mesh);
+        assembler.SetAddElementMatricesInPlace(true);
+        assembler.SetMatrixToAssemble(mat);
+        for (unsigned i=0; i<3; i++)
+        {
+            assembler.Assemble();
+            PetscMatTools::Finalise(mat);
+            TS_ASSERT(PetscMatTools::CheckEquality(mat, reference_mat, 1e-12));
+        }
+
+        // Element matrices with entries missing from the sparsity pattern are still added
+        Mat diagonal_mat;
+        PetscTools::SetupMat(diagonal_mat, num_nodes, num_nodes, 9);
+        PetscInt lo, hi;
+        PetscMatTools::GetOwnershipRange(diagonal_mat, lo, hi);
+        for (PetscInt i=lo; i<hi; i++)
+        {
+            PetscMatTools::SetElement(diagonal_mat, i, i, 1.0);
+        }
+        PetscMatTools::Finalise(diagonal_mat);
+        PetscMatTools::TurnOffVariableAllocationError(diagonal_mat);
+
+        assembler.SetMatrixToAssemble(diagonal_mat);
+        assembler.Assemble();
+        PetscMatTools::Finalise(diagonal_mat);
+        TS_ASSERT(PetscMatTools::CheckEquality(diagonal_mat, reference_mat, 1e-12));
+
+        PetscTools::Destroy(reference_mat);
+        PetscTools::Destroy(mat);
+        PetscTools::Destroy(diagonal_mat);
+    }
+
     void TestInterpolationOfPositionAndCurrentSolution()
     {
         TetrahedralMesh<1,1> mesh;
@@ -195,6 +195,8 @@ public:
 
         mesh_pair.ComputeFineElementsAndWeightsForCoarseQuadPoints(quad_rule, true);
 
+        // Safe mode uses a spatial index on the fine mesh for its whole-mesh searches, but leaves the mesh as it found it
+        TS_ASSERT_EQUALS(fine_mesh.IsElementSpatialIndexSetUp(), false);
 
         ///\todo #2308 These quantities are not shared yet...
         if (PetscTools::IsSequential())
@@ -236,6 +238,21 @@ public:
             TS_ASSERT_EQUALS( Warnings::Instance()->GetNumWarnings(), 1u);
         }
         Warnings::Instance()->QuietDestroy();
+
+        // An index that was already set up on the fine mesh is used, kept, and gives the same elements
+        std::vector<unsigned> element_nums;
+        for (unsigned i=0; i<mesh_pair.rGetElementsAndWeights().size(); i++)
+        {
+            element_nums.push_back(mesh_pair.rGetElementsAndWeights()[i].ElementNum);
+        }
+        fine_mesh.SetUpElementSpatialIndex();
+        mesh_pair.ComputeFineElementsAndWeightsForCoarseQuadPoints(quad_rule, true);
+        TS_ASSERT_EQUALS(fine_mesh.IsElementSpatialIndexSetUp(), true);
+        for (unsigned i=0; i<mesh_pair.rGetElementsAndWeights().size(); i++)
+        {
+            TS_ASSERT_EQUALS(mesh_pair.rGetElementsAndWeights()[i].ElementNum, element_nums[i]);
+        }
+        Warnings::Instance()->QuietDestroy();
     }
 
 ////Bring back this functionality if needed
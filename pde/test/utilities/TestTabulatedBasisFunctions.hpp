@@ -0,0 +1,112 @@
+/*
+
+Copyright (c) 2005-2017, University of Oxford.
+All rights reserved.
+
+University of Oxford means the Chancellor, Masters and Scholars of the
+University of Oxford, having an administrative office at Wellington
+Square, Oxford OX1 2JD, UK.
+
+This file is part of Chaste.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+ * Redistributions of source code must retain the above copyright notice,
+   this list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+ * Neither the name of the University of Oxford nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#ifndef _TESTTABULATEDBASISFUNCTIONS_HPP_
+#define _TESTTABULATEDBASISFUNCTIONS_HPP_
+
+#include <cxxtest/TestSuite.h>
+#include "TabulatedBasisFunctions.hpp"
+#include "LinearBasisFunction.hpp"
+#include "QuadraticBasisFunction.hpp"
+
+#include "PetscSetupAndFinalize.hpp"
+
+class TestTabulatedBasisFunctions : public CxxTest::TestSuite
+{
+private:
+
+    template<unsigned DIM>
+    void CheckAgainstBasisFunctions(unsigned quadratureOrder)
+    {
+        const unsigned NUM_QUADRATIC_BASIS_FUNCTIONS = (DIM+1)*(DIM+2)/2;
+
+        GaussianQuadratureRule<DIM> quad_rule(quadratureOrder);
+        TabulatedBasisFunctions<DIM> tabulated_basis_functions(quad_rule);
+        TS_ASSERT_EQUALS(tabulated_basis_functions.GetNumQuadPoints(), quad_rule.GetNumQuadPoints());
+
+        // An arbitrary inverse Jacobian
+        c_matrix<double, DIM, DIM> inverse_jacobian;
+        for (unsigned i=0; i<DIM; i++)
+        {
+            for (unsigned j=0; j<DIM; j++)
+            {
+                inverse_jacobian(i,j) = (i==j) ? 2.0 : 0.1*(i+2*j+1);
+            }
+        }
+
+        c_vector<double, DIM+1> linear_phi;
+        c_vector<double, NUM_QUADRATIC_BASIS_FUNCTIONS> quad_phi;
+        c_matrix<double, DIM, NUM_QUADRATIC_BASIS_FUNCTIONS> grad_quad_phi;
+        c_matrix<double, DIM, NUM_QUADRATIC_BASIS_FUNCTIONS> tabulated_grad_quad_phi;
+
+        for (unsigned quad_index=0; quad_index<quad_rule.GetNumQuadPoints(); quad_index++)
+        {
+            const ChastePoint<DIM>& r_quad_point = quad_rule.rGetQuadPoint(quad_index);
+
+            LinearBasisFunction<DIM>::ComputeBasisFunctions(r_quad_point, linear_phi);
+            QuadraticBasisFunction<DIM>::ComputeBasisFunctions(r_quad_point, quad_phi);
+            QuadraticBasisFunction<DIM>::ComputeTransformedBasisFunctionDerivatives(r_quad_point, inverse_jacobian, grad_quad_phi);
+            tabulated_basis_functions.ComputeTransformedQuadraticBasisFunctionDerivatives(quad_index, inverse_jacobian, tabulated_grad_quad_phi);
+
+            // The results should be identical, not just close
+            for (unsigned i=0; i<DIM+1; i++)
+            {
+                TS_ASSERT_EQUALS(tabulated_basis_functions.rGetLinearBasisFunctions(quad_index)(i), linear_phi(i));
+            }
+            for (unsigned i=0; i<NUM_QUADRATIC_BASIS_FUNCTIONS; i++)
+            {
+                TS_ASSERT_EQUALS(tabulated_basis_functions.rGetQuadraticBasisFunctions(quad_index)(i), quad_phi(i));
+                for (unsigned j=0; j<DIM; j++)
+                {
+                    TS_ASSERT_EQUALS(tabulated_grad_quad_phi(j,i), grad_quad_phi(j,i));
+                }
+            }
+        }
+    }
+
+public:
+
+    void TestTabulatedBasisFunctionsMatchBasisFunctions()
+    {
+        for (unsigned order=0; order<4; order++)
+        {
+            CheckAgainstBasisFunctions<1>(order);
+            CheckAgainstBasisFunctions<2>(order);
+            CheckAgainstBasisFunctions<3>(order);
+        }
+    }
+};
+
+#endif // _TESTTABULATEDBASISFUNCTIONS_HPP_